@@ -6,9 +6,9 @@
 *//**************************************************/
 #include "Animal.h"
 #include "ShaderManager.h"
+#include "FlockManager.h"
+#include "AnimalDeathManager.h"
 #include "FieldManager.h"
-#include "Main.h"
-#include "CarnivorousAnimal.h"
 
 /*****************************************//*
 	@brief@	| RXgN^
@@ -16,6 +16,12 @@
 CAnimal::CAnimal()
 	: CEntity()
 	, m_f3Velocity({ 0.0f, 0.0f, 0.0f })
+	, m_f3Steering({ 0.0f, 0.0f, 0.0f })
+	, m_eAnimalKind(AnimalKind::Wolf)
+	, m_nAnimalHandle(CAnimalSpatialGrid::INVALID_HANDLE)
+	, m_fViewRadius(0.0f)
+	, m_pFlock(nullptr)
+	, m_isCollapsed(false)
 	, m_pActionAI(nullptr)
 {
 	// f_[R|[lg̒ǉ
@@ -35,22 +41,119 @@ CAnimal::CAnimal()
 *//*****************************************/
 CAnimal::~CAnimal()
 {
-	// ̗͂0ȉȂUĎŜ
-	if (IsDead())
-	{
-		// ͈͓̓H擾
-		std::list<CCarnivorousAnimal*> carnivorousAnimals;
-		carnivorousAnimals = GetScene()->GetGameObjects<CCarnivorousAnimal>(m_tParam.m_f3Pos, 20.0f);
-		// 擾HSĂ̋󕠓x񕜂
-		for (CCarnivorousAnimal* pCarnivorousAnimal : carnivorousAnimals)
-		{
-			pCarnivorousAnimal->RecoverHunger(80.0f);
-		}
-	}
+	// ԃObho^
+	CAnimalSpatialGrid::GetInstance()->Unregister(m_nAnimalHandle);
+
+	// Qꂩ痣E
+	CFlockManager::GetInstance()->Leave(m_pFlock, m_nAnimalHandle);
+
+	// SCxgςށiߐHƃZ̉̓IuWFNg̍폜̌ɂ܂Ƃ߂čsj
+	AnimalDeathEvent tEvent;
+	tEvent.f3Pos = m_tParam.m_f3Pos;
+	tEvent.n2BornCell = m_n2BornCellIndex;
+	// ̗͂0ȉȂUĎŜŎ[c
+	tEvent.isKilled = IsDead();
+	CAnimalDeathManager::GetInstance()->Push(tEvent);
 
 	// ̍sAỈ
 	SAFE_DELETE(m_pActionAI);
+}
+
+/*****************************************//*
+	@brief@	| `揈
+*//*****************************************/
+void CAnimal::Draw()
+{
+	// QɏW񂳂ĂԂ͕`悵Ȃ
+	if (m_isCollapsed) return;
+
+	CEntity::Draw();
+}
+
+/*****************************************//*
+	@brief@	| Qւ̏W
+*//*****************************************/
+void CAnimal::Collapse()
+{
+	m_isCollapsed = true;
+
+	// WJɑÕXeAOcȂ悤ɂ
+	m_f3Steering = { 0.0f, 0.0f, 0.0f };
+}
+
+/*****************************************//*
+	@brief@	| Qꂩ̓WJ
+	@param		| f3PosFWJʒu
+	@param		| f3VelocityFWJ̑x
+	@param		| fStaminaFWJ̃X^~i
+*//*****************************************/
+void CAnimal::Expand(const DirectX::XMFLOAT3& f3Pos, const DirectX::XMFLOAT3& f3Velocity, float fStamina)
+{
+	m_isCollapsed = false;
+	m_tParam.m_f3Pos = f3Pos;
+	m_f3Velocity = f3Velocity;
+	m_tParam.m_f3Rotate.y = atan2f(f3Velocity.x, f3Velocity.z);
+
+	// X^~iQ̕ςɍ킹
+	const float fDiff = fStamina - GetStamina();
+	if (fDiff > 0.0f) RecoverStamina(fDiff);
+	else DecreaseStamina(-fDiff);
+}
+
+/*****************************************//*
+	@brief@	| Q̋ߗ׏̍쐬
+	@return		| ̓猩g̈ʒuExEWI
+*//*****************************************/
+BoidsNeighbor CAnimal::MakeBoidsNeighbor() const
+{
+	BoidsNeighbor neighbor;
+	neighbor.v3Position = m_tParam.m_f3Pos;
+	neighbor.v3Velocity = m_f3Velocity;
+	neighbor.bSetTarget = false;
+	neighbor.pTargetPos = { 0.0f, 0.0f, 0.0f };
+	return neighbor;
+}
+
+/*****************************************//*
+	@brief@	| ԃObhւ̓o^
+	@param		| eKindF̎
+	@param		| fViewRadiusFߗׂ̓Ta
+*//*****************************************/
+void CAnimal::RegisterToSpatialGrid(AnimalKind eKind, float fViewRadius)
+{
+	m_eAnimalKind = eKind;
+	m_fViewRadius = fViewRadius;
+	m_nAnimalHandle = CAnimalSpatialGrid::GetInstance()->Register(this, eKind);
+}
+
+/*****************************************//*
+	@brief@	| ߗׂ̓̎擾ƍsAĨXeAOvZ
+*//*****************************************/
+void CAnimal::ComputeSteering()
+{
+	// ߗׂ̓̓ԃObh擾
+	CAnimalSpatialGrid::GetInstance()->GatherNeighbors(m_nAnimalHandle, m_eAnimalKind, m_tParam.m_f3Pos, m_fViewRadius, m_SameAnimalNeighbors);
+
+	// sAĨXeAOvZ
+	m_f3Steering = m_pActionAI->UpdateAI(m_tParam.m_f3Pos, m_f3Velocity, m_SameAnimalNeighbors);
+}
+
+/*****************************************//*
+	@brief@	| ܂ꂽ꒣̌QɎQ
+*//*****************************************/
+void CAnimal::JoinFlock()
+{
+	if (m_pFlock != nullptr) return;
+
+	// aꏊ̃Z̓꒣ԍŌQ߂
+	CFieldManager* pFieldManager = CFieldManager::GetInstance();
+	CFieldCell* pCell = pFieldManager->GetFieldGrid()->GetFieldCells()[m_n2BornCellIndex.x][m_n2BornCellIndex.y];
+	const int nTerritoryId = pCell->GetTerritoryId();
+	if (nTerritoryId < 0) return;
+
+	m_pFlock = CFlockManager::GetInstance()->Join(m_nAnimalHandle, m_eAnimalKind, nTerritoryId, pFieldManager->GetTerritoryCenter(nTerritoryId));
+	if (m_pFlock == nullptr) return;
 
-	// o^ĂZ̎gptO
-	CFieldManager::GetInstance()->GetFieldGrid()->GetFieldCells()[m_n2BornCellIndex.x][m_n2BornCellIndex.y]->SetUse(false);
+	// sAIQ̏WvlQƂł悤ɂ
+	m_pActionAI->SetFlock(m_pFlock);
 }
\ No newline at end of file
@@ -8,6 +8,10 @@
 #include "Entity.h"
 #include "AnimalAI.h"
 #include "ModelRenderer.h"
+#include "AnimalSpatialGrid.h"
+
+// O錾
+class CFlock;
 
 // @brief NX
 class CAnimal : public CEntity
@@ -19,9 +23,56 @@ public:
 	// @brief fXgN^
 	~CAnimal();
 
+	// @brief `揈
+	// @note QɏW񂳂ĂԂ͕`悵Ȃ
+	void Draw() override;
+
 	// @brief Z̓o^
 	void RegisterToCell(DirectX::XMINT2 In_n2Cell) { m_n2BornCellIndex = In_n2Cell; }
 
+	// @brief ԃObh̃nh擾
+	// @return ̓WIƂĕێnh
+	int GetAnimalHandle() const { return m_nAnimalHandle; }
+
+	// @brief x擾
+	const DirectX::XMFLOAT3& GetVelocity() const { return m_f3Velocity; }
+
+	// @brief ܂ꂽ꒣̌QɎQ
+	// @note aꏊ̃Zo^ɌĂяo
+	void JoinFlock();
+
+	// @brief Q̎擾
+	CFlock* GetFlock() const { return m_pFlock; }
+
+	// @brief QɏW񂳂Ă邩ǂ
+	bool IsCollapsed() const { return m_isCollapsed; }
+
+	// @brief Qւ̏W
+	// @note W񒆂͍XVE`EXeAOvZs킸AԃObh̒Tɂ|Ȃ
+	void Collapse();
+
+	// @brief Qꂩ̓WJ
+	// @param f3PosFWJʒu
+	// @param f3VelocityFWJ̑x
+	// @param fStaminaFWJ̃X^~iiQ̕σX^~ij
+	void Expand(const DirectX::XMFLOAT3& f3Pos, const DirectX::XMFLOAT3& f3Velocity, float fStamina);
+
+	// @brief Q̋ߗ׏̍쐬
+	// @return ̓猩g̈ʒuExEWI
+	// @note ԃObh̍č\zɌĂ΂
+	virtual BoidsNeighbor MakeBoidsNeighbor() const;
+
+	// @brief ߗׂ̓̎擾ƍsAĨXeAOvZ
+	// @note CAnimalSimulationɌĂ΂̂ŁAԃObh̋L^
+	//       g̏Ԃǂ݁Ag̃XeAOɏ
+	void ComputeSteering();
+
+protected:
+	// @brief ԃObhւ̓o^
+	// @param eKindF̎
+	// @param fViewRadiusFߗׂ̓Ta
+	void RegisterToSpatialGrid(AnimalKind eKind, float fViewRadius);
+
 protected:
 	// @brief aꏊ̃ZCfbNX
 	DirectX::XMINT2 m_n2BornCellIndex;
@@ -29,9 +80,27 @@ protected:
 	// @brief ̑x
 	DirectX::XMFLOAT3 m_f3Velocity;
 
-	// @brief ɂ铯̓Xg
+	// @brief ɂ铯̓Xgit[ԃObh擾j
 	std::vector<BoidsNeighbor> m_SameAnimalNeighbors;
 
+	// @brief t[̍sAĨXeAOiXVOɌvZς݁j
+	DirectX::XMFLOAT3 m_f3Steering;
+
+	// @brief ̎
+	AnimalKind m_eAnimalKind;
+
+	// @brief ԃObh̃nh
+	int m_nAnimalHandle;
+
+	// @brief ߗׂ̓Ta
+	float m_fViewRadius;
+
+	// @brief Q
+	CFlock* m_pFlock;
+
+	// @brief QɏW񂳂Ă邩ǂ
+	bool m_isCollapsed;
+
 	// @brief ̍sAI
 	CAnimalAI* m_pActionAI;
 };
@@ -6,6 +6,9 @@
 #pragma once
 #include "BoidsSteering.h"
 
+// O錾
+class CFlock;
+
 // @brief AINX
 class CAnimalAI
 {
@@ -18,5 +21,9 @@ public:
 	// @param velF̌ݑx
 	// @param neighborsFߗׂ̓񃊃Xg
 	virtual DirectX::XMFLOAT3 UpdateAI(const DirectX::XMFLOAT3& pos,const DirectX::XMFLOAT3& vel,const std::vector<BoidsNeighbor>& neighbors) = 0;
+
+	// @brief Q̐ݒ
+	// @param pFlockFQiQ̏WvlQƂAIgj
+	virtual void SetFlock(const CFlock* pFlock) {}
 };
 
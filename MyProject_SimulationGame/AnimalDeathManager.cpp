@@ -0,0 +1,78 @@
+/**************************************************//*
+	@file	| AnimalDeathManager.cpp
+	@brief	| ̎SCxgǗVXecppt@C
+	@note	| ̔jɎSCxgςނɂA
+			| IuWFNg̍폜̌ɂ܂Ƃ߂ď
+			| UĎS͋߂̓H̋󕠓x񕜂iߐHj
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "AnimalDeathManager.h"
+#include "Animal.h"
+#include "FieldManager.h"
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CAnimalDeathManager::CAnimalDeathManager()
+	: m_Events()
+	, m_nFeederHandles()
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CAnimalDeathManager::~CAnimalDeathManager()
+{
+}
+
+/*****************************************//*
+	@brief@	| SCxg̒ǉ
+	@param		| tEventFSCxg
+*//*****************************************/
+void CAnimalDeathManager::Push(const AnimalDeathEvent& tEvent)
+{
+	m_Events.push_back(tEvent);
+}
+
+/*****************************************//*
+	@brief@	| XV
+	@note		| Sɏ̂ŁAt[ɎS͕̏ςȂ
+*//*****************************************/
+void CAnimalDeathManager::Update()
+{
+	if (m_Events.empty()) return;
+
+	CFieldGrid* pFieldGrid = CFieldManager::GetInstance()->GetFieldGrid();
+
+	for (const AnimalDeathEvent& tEvent : m_Events)
+	{
+		// UĎSꍇ͎[߂̓HHׂ
+		if (tEvent.isKilled) Feed(tEvent.f3Pos);
+
+		// o^ĂZ̎gptOAĐΏۂƂċL^
+		pFieldGrid->ReleaseCell(pFieldGrid->GetFieldCells()[tEvent.n2BornCell.x][tEvent.n2BornCell.y]);
+	}
+	m_Events.clear();
+}
+
+/*****************************************//*
+	@brief@	| [߂̓HɐHׂ
+	@param		| f3PosF[̈ʒu
+	@note		| ԃObh̒TaɊ|Z𒲂ׂ
+*//*****************************************/
+void CAnimalDeathManager::Feed(const DirectX::XMFLOAT3& f3Pos)
+{
+	CAnimalSpatialGrid* pGrid = CAnimalSpatialGrid::GetInstance();
+
+	// H͘T
+	pGrid->GatherHandles(AnimalKind::Wolf, f3Pos, FEED_RADIUS, m_nFeederHandles);
+	for (int nHandle : m_nFeederHandles)
+	{
+		// t[ɔjꂽT͏
+		CAnimal* pAnimal = pGrid->FindAnimal(nHandle);
+		if (!pAnimal) continue;
+
+		pAnimal->RecoverHunger(FEED_AMOUNT);
+	}
+}
@@ -0,0 +1,62 @@
+/**************************************************//*
+	@file	| AnimalDeathManager.h
+	@brief	| ̎SCxgǗVXeht@C
+	@note	| ̔jɎSCxgςނɂA
+			| IuWFNg̍폜̌ɂ܂Ƃ߂ď
+			| UĎS͋߂̓H̋󕠓x񕜂iߐHj
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include "AnimalSpatialGrid.h"
+#include <vector>
+
+// @brief ̎SCxg
+struct AnimalDeathEvent
+{
+	DirectX::XMFLOAT3 f3Pos;		// Sʒu
+	DirectX::XMINT2 n2BornCell;		// aꏊ̃ZCfbNX
+	bool isKilled;					// UĎSi[c邩j
+};
+
+// @brief ̎SCxgǗVXeNX
+class CAnimalDeathManager : public ISingleton<CAnimalDeathManager>
+{
+public:
+	// @brief [Hׂ鋗
+	static constexpr float FEED_RADIUS = 20.0f;
+
+	// @brief [񕜂󕠓x
+	static constexpr float FEED_AMOUNT = 80.0f;
+
+private:
+	// @brief RXgN^
+	CAnimalDeathManager();
+
+	friend class ISingleton<CAnimalDeathManager>;
+
+public:
+	// @brief fXgN^
+	~CAnimalDeathManager();
+
+	// @brief SCxg̒ǉ
+	// @param tEventFSCxg
+	// @note ̃fXgN^Ă΂̂ŁAςނő̃IuWFNgɂ͐GȂ
+	void Push(const AnimalDeathEvent& tEvent);
+
+	// @brief XV
+	// @note IuWFNg̍폜̌ɌĂяoÃt[̎SCxg܂Ƃ߂ď
+	void Update();
+
+private:
+	// @brief [߂̓HɐHׂ
+	// @param f3PosF[̈ʒu
+	void Feed(const DirectX::XMFLOAT3& f3Pos);
+
+private:
+	// @brief ̃t[̎SCxg
+	std::vector<AnimalDeathEvent> m_Events;
+
+	// @brief ߂̓H̃nhiƗ̈g񂷁j
+	std::vector<int> m_nFeederHandles;
+};
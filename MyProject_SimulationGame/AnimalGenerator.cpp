@@ -11,50 +11,44 @@
 #include "Wolf_Animal.h"
 #include "Deer_Animal.h"
 
-/*****************************************//*
-	@brief@	| 
-*//*****************************************/
-void CAnimalGenerator::Generate()
+namespace
 {
-	// tB[hZ2z擾
-	std::vector<std::vector<CFieldCell*>> pFieldCells = CFieldManager::GetInstance()->GetFieldGrid()->GetFieldCells();
+	/*****************************************//*
+		@brief@	| 󂢂꒣̃Zɓ܂Ƃ߂Đ
+		@param		| cellsFZ
+		@param		| inNameFIuWFNg̖O
+	*//*****************************************/
+	template<class T>
+	void SpawnAnimals(const std::vector<CFieldCell*>& cells, const std::string& inName)
+	{
+		if (cells.empty()) return;
 
-	// ̃Xg
-	std::vector<CWolf_Animal*> wolfList;
-	std::vector<CDeer_Animal*> deerList;
+		// V[ւ̒ǉ1ɂ܂Ƃ߂
+		std::vector<T*> animals = GetScene()->AddGameObjects<T>(Tag::GameObject, inName, cells.size());
 
-	// tB[hZ𑖍ē𐶐
-	for (std::vector<CFieldCell*> cells : pFieldCells)
-	{
-		for (CFieldCell* cell : cells)
+		// ZɔzuA꒣̌QɎQ
+		for (size_t i = 0; i < animals.size(); ++i)
 		{
-			// IIJ~
-			if (cell->GetTerritoryType() == CFieldCell::TerritoryType::Wolf && !cell->IsUse())
-			{
-				CWolf_Animal* pWolf = GetScene()->AddGameObject<CWolf_Animal>(Tag::GameObject, u8"T");
-				pWolf->SetPos(cell->GetPos());
-				pWolf->RegisterToCell(cell->GetIndex());
-				wolfList.push_back(pWolf);
-				cell->SetUse(true);
-			}
-			// 
-			else if (cell->GetTerritoryType() == CFieldCell::TerritoryType::Deer && !cell->IsUse())
-			{
-				CDeer_Animal* pDeer = GetScene()->AddGameObject<CDeer_Animal>(Tag::GameObject, u8"");
-				pDeer->SetPos(cell->GetPos());
-				pDeer->RegisterToCell(cell->GetIndex());
-				deerList.push_back(pDeer);
-				cell->SetUse(true);
-			}
+			CFieldCell* cell = cells[i];
+			animals[i]->SetPos(cell->GetPos());
+			animals[i]->RegisterToCell(cell->GetIndex());
+			animals[i]->JoinFlock();
+			cell->SetUse(true);
 		}
 	}
-	// Q̌`
-	for (CWolf_Animal* wolf : wolfList)
-	{
-		wolf->RegisterToFlock(wolfList);
-	}
-	for (CDeer_Animal* deer : deerList)
-	{
-		deer->RegisterToFlock(deerList);
-	}
+}
+
+/*****************************************//*
+	@brief@	| 
+*//*****************************************/
+void CAnimalGenerator::Generate()
+{
+	// tB[hObh̎擾
+	CFieldGrid* pFieldGrid = CFieldManager::GetInstance()->GetFieldGrid();
+
+	// O̐ȍ~ɋ󂢂꒣̃Zɓ𐶐itB[hŜ͑Ȃj
+	// IIJ~
+	SpawnAnimals<CWolf_Animal>(pFieldGrid->TakeFreedCells(CFieldCell::TerritoryType::Wolf), u8"T");
+	// 
+	SpawnAnimals<CDeer_Animal>(pFieldGrid->TakeFreedCells(CFieldCell::TerritoryType::Deer), u8"");
 }
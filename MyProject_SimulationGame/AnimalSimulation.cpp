@@ -0,0 +1,88 @@
+/**************************************************//*
+	@file	| AnimalSimulation.cpp
+	@brief	| ̌QV~[Vcppt@C
+	@note	| t[̍ŏɑS̈ʒuExԃObhɋL^iOobt@jA
+			| L^ǂőS̃XeAOɌvZiobt@j
+			| e͎g̍XVŌvZς݂̃XeAOKp
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "AnimalSimulation.h"
+#include "AnimalSpatialGrid.h"
+#include "Animal.h"
+#include "FlockManager.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CAnimalSimulation::CAnimalSimulation()
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CAnimalSimulation::~CAnimalSimulation()
+{
+}
+
+/*****************************************//*
+	@brief@	| XV
+	@note		| e͑Oobt@Ǝg̏Ԃǂ݁Aǧobt@ɏނ̂
+				| Xbh̕⓮̕яɂČʂςȂ
+*//*****************************************/
+void CAnimalSimulation::Update()
+{
+	CAnimalSpatialGrid* pGrid = CAnimalSpatialGrid::GetInstance();
+
+	// Q̏WEWJƁASEE_QꂲƂ1񂾂XV
+	// iW񂵂Oobt@Ɋ܂߂Ȃ悤Ač\zɍsj
+	CFlockManager::GetInstance()->Update();
+
+	// Oobt@̍쐬iW񂳂ĂȂS̍t[Jn̈ʒuExEWIL^j
+	pGrid->Rebuild();
+
+	const size_t nCount = pGrid->GetActiveAnimalCount();
+	if (nCount == 0) return;
+
+	// XbȟiȂ烁CXbhŌvZj
+	unsigned int hwThreads = std::thread::hardware_concurrency();
+	if (hwThreads == 0) hwThreads = 2;
+	const size_t numThreads = std::min<size_t>(hwThreads, (nCount + MIN_ANIMALS_PER_THREAD - 1) / MIN_ANIMALS_PER_THREAD);
+
+	if (numThreads <= 1)
+	{
+		ComputeSteeringRange(pGrid, 0, nCount);
+		return;
+	}
+
+	// ͈͂𕪊ĕɌvZiŌ͈̔͂̓CXbhŌvZj
+	std::vector<std::thread> threads;
+	threads.reserve(numThreads - 1);
+
+	for (size_t t = 0; t < numThreads - 1; ++t)
+	{
+		size_t nBegin = nCount * t / numThreads;
+		size_t nEnd = nCount * (t + 1) / numThreads;
+		threads.emplace_back(&CAnimalSimulation::ComputeSteeringRange, pGrid, nBegin, nEnd);
+	}
+	ComputeSteeringRange(pGrid, nCount * (numThreads - 1) / numThreads, nCount);
+
+	for (auto& th : threads) if (th.joinable()) th.join();
+}
+
+/*****************************************//*
+	@brief@	| ͈͓̓̃XeAOvZ
+	@param		| pGridFč\zς݂̋ԃObh
+	@param		| nBeginFJnCfbNX
+	@param		| nEndFICfbNXi܂܂Ȃj
+*//*****************************************/
+void CAnimalSimulation::ComputeSteeringRange(const CAnimalSpatialGrid* pGrid, size_t nBegin, size_t nEnd)
+{
+	for (size_t i = nBegin; i < nEnd; ++i)
+	{
+		pGrid->GetActiveAnimal(i)->ComputeSteering();
+	}
+}
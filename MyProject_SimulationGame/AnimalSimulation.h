@@ -0,0 +1,42 @@
+/**************************************************//*
+	@file	| AnimalSimulation.h
+	@brief	| ̌QV~[Vht@C
+	@note	| t[̍ŏɑS̈ʒuExԃObhɋL^iOobt@jA
+			| L^ǂőS̃XeAOɌvZiobt@j
+			| e͎g̍XVŌvZς݂̃XeAOKp
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+
+// O錾
+class CAnimalSpatialGrid;
+
+// @brief ̌QV~[VNX
+class CAnimalSimulation : public ISingleton<CAnimalSimulation>
+{
+public:
+	// @brief 1XbhSŒ̓i菭Ȃ΃Xbh𕪂Ȃj
+	static constexpr size_t MIN_ANIMALS_PER_THREAD = 64;
+
+private:
+	// @brief RXgN^
+	CAnimalSimulation();
+
+	friend class ISingleton<CAnimalSimulation>;
+
+public:
+	// @brief fXgN^
+	~CAnimalSimulation();
+
+	// @brief XV
+	// @note ̍XVOɌĂяo
+	void Update();
+
+private:
+	// @brief ͈͓̓̃XeAOvZ
+	// @param pGridFč\zς݂̋ԃObh
+	// @param nBeginFJnCfbNX
+	// @param nEndFICfbNXi܂܂Ȃj
+	static void ComputeSteeringRange(const CAnimalSpatialGrid* pGrid, size_t nBegin, size_t nEnd);
+};
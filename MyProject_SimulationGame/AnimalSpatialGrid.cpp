@@ -0,0 +1,259 @@
+/**************************************************//*
+	@file	| AnimalSpatialGrid.cpp
+	@brief	| ̋ԃObhcppt@C
+	@note	| ̈ʒuXZʂ̈lObhɖt[o^A
+			| 씼a̓̓߂ɏ܂Ŏ擾
+			| o^ɍėpȂnh𔭍sAWI̒ǐՂɎg
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "AnimalSpatialGrid.h"
+#include "Animal.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// @brief ZԍɎgrbg
+	constexpr int CELL_BITS = 20;
+
+	// @brief ̃Zԍ𐳂ɂ邽߂̃ItZbg
+	constexpr int CELL_OFFSET = 1 << (CELL_BITS - 1);
+
+	// @brief Zԍ̃}XN
+	constexpr uint64_t CELL_MASK = (uint64_t(1) << CELL_BITS) - 1;
+}
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CAnimalSpatialGrid::CAnimalSpatialGrid()
+	: m_Animals()
+	, m_HandleToIndex()
+	, m_nNextHandle(0)
+	, m_Entries()
+	, m_pActiveAnimals()
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CAnimalSpatialGrid::~CAnimalSpatialGrid()
+{
+}
+
+/*****************************************//*
+	@brief@	| ̓o^
+	@param		| pAnimalFo^铮
+	@param		| eKindF̎
+	@return		| ̃nh
+*//*****************************************/
+int CAnimalSpatialGrid::Register(CAnimal* pAnimal, AnimalKind eKind)
+{
+	const int nHandle = m_nNextHandle++;
+	m_HandleToIndex[nHandle] = m_Animals.size();
+	m_Animals.push_back({ pAnimal, eKind, nHandle });
+	return nHandle;
+}
+
+/*****************************************//*
+	@brief@	| ̓o^
+	@param		| nHandleFo^铮̃nh
+	@note		| L^ς݂̃Gg͎̍č\z܂Ŏc邪A
+				| nhŎQƂ̂FindAnimalnullptrԂ
+*//*****************************************/
+void CAnimalSpatialGrid::Unregister(int nHandle)
+{
+	auto itIndex = m_HandleToIndex.find(nHandle);
+	if (itIndex == m_HandleToIndex.end()) return;
+
+	// Ԃ͖Ȃ̂ŖƓւč폜
+	const size_t nIndex = itIndex->second;
+	m_HandleToIndex.erase(itIndex);
+	if (nIndex != m_Animals.size() - 1)
+	{
+		m_Animals[nIndex] = m_Animals.back();
+		m_HandleToIndex[m_Animals[nIndex].nHandle] = nIndex;
+	}
+	m_Animals.pop_back();
+}
+
+/*****************************************//*
+	@brief@	| nh瓮̎擾
+	@param		| nHandleF̃nh
+	@return		| Ao^ς݂Ȃnullptr
+*//*****************************************/
+CAnimal* CAnimalSpatialGrid::FindAnimal(int nHandle) const
+{
+	auto itIndex = m_HandleToIndex.find(nHandle);
+	if (itIndex == m_HandleToIndex.end()) return nullptr;
+	return m_Animals[itIndex->second].pAnimal;
+}
+
+/*****************************************//*
+	@brief@	| Obh̍č\z
+*//*****************************************/
+void CAnimalSpatialGrid::Rebuild()
+{
+	m_Entries.clear();
+	m_Entries.reserve(m_Animals.size());
+	m_pActiveAnimals.clear();
+
+	// Š݂̏ԂL^
+	for (const RegisteredAnimal& animal : m_Animals)
+	{
+		// QɏW񂳂Ă铮͌Qꂪ܂Ƃ߂Ĉ
+		if (animal.pAnimal->IsCollapsed()) continue;
+		m_pActiveAnimals.push_back(animal.pAnimal);
+
+		GridEntry entry;
+		entry.nHandle = animal.nHandle;
+		entry.neighbor = animal.pAnimal->MakeBoidsNeighbor();
+		entry.nKey = MakeKey(animal.eKind, ToCell(entry.neighbor.v3Position.x), ToCell(entry.neighbor.v3Position.z));
+		m_Entries.push_back(entry);
+	}
+
+	// L[ɕׁAZ̓A
+	std::sort(m_Entries.begin(), m_Entries.end(),
+		[](const GridEntry& a, const GridEntry& b) { return a.nKey < b.nKey; });
+}
+
+/*****************************************//*
+	@brief@	| TaɊ|Z̋L^Ƃɏ
+	@param		| eKindF̎
+	@param		| f3PosFT̒Sʒu
+	@param		| fRadiusFTa
+	@param		| funcFa̋L^ƂɌĂԊ֐iL^, CfbNX, 2j
+*//*****************************************/
+template<class Func>
+void CAnimalSpatialGrid::ForEachInRadius(AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius, Func func) const
+{
+	const float fRadiusSq = fRadius * fRadius;
+	const int nMinX = ToCell(f3Pos.x - fRadius);
+	const int nMaxX = ToCell(f3Pos.x + fRadius);
+	const int nMinZ = ToCell(f3Pos.z - fRadius);
+	const int nMaxZ = ToCell(f3Pos.z + fRadius);
+
+	auto keyLess = [](const GridEntry& entry, uint64_t nKey) { return entry.nKey < nKey; };
+
+	// Z̃Z̓L[AĂ̂ŁAX̃ZƂɔ͈͂xT
+	for (int x = nMinX; x <= nMaxX; ++x)
+	{
+		const uint64_t nEndKey = MakeKey(eKind, x, nMaxZ);
+		auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), MakeKey(eKind, x, nMinZ), keyLess);
+		for (; it != m_Entries.end() && it->nKey <= nEndKey; ++it)
+		{
+			const float fDX = it->neighbor.v3Position.x - f3Pos.x;
+			const float fDZ = it->neighbor.v3Position.z - f3Pos.z;
+			const float fDistSq = fDX * fDX + fDZ * fDZ;
+			if (fDistSq > fRadiusSq) continue;
+
+			func(*it, static_cast<size_t>(it - m_Entries.begin()), fDistSq);
+		}
+	}
+}
+
+/*****************************************//*
+	@brief@	| ߗׂ̓̎擾
+	@param		| nSelfHandleF擾铮g̃nh
+	@param		| eKindF̎
+	@param		| f3PosFT̒Sʒu
+	@param		| fRadiusFTa
+	@param		| Out_NeighborsFߗׂ̓
+*//*****************************************/
+void CAnimalSpatialGrid::GatherNeighbors(int nSelfHandle, AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius, std::vector<BoidsNeighbor>& Out_Neighbors) const
+{
+	// ߗ׌̍Ɨ̈i2, L^̃CfbNXj̓XbhƂɎg
+	thread_local std::vector<std::pair<float, size_t>> candidates;
+	candidates.clear();
+	Out_Neighbors.clear();
+
+	ForEachInRadius(eKind, f3Pos, fRadius, [&](const GridEntry& entry, size_t nIndex, float fDistSq)
+	{
+		if (entry.nHandle == nSelfHandle) return;
+		candidates.push_back({ fDistSq, nIndex });
+	});
+
+	// 𒴂ꍇ͋߂c
+	if (candidates.size() > MAX_NEIGHBORS)
+	{
+		std::nth_element(candidates.begin(), candidates.begin() + MAX_NEIGHBORS, candidates.end());
+		candidates.resize(MAX_NEIGHBORS);
+	}
+	std::sort(candidates.begin(), candidates.end());
+
+	for (const auto& candidate : candidates)
+	{
+		Out_Neighbors.push_back(m_Entries[candidate.second].neighbor);
+	}
+}
+
+/*****************************************//*
+	@brief@	| ͈͓ōł߂̎擾
+	@param		| eKindFT̎
+	@param		| f3PosFT̒Sʒu
+	@param		| fRadiusFTa
+	@return		| ł߂̃nhA͈͓ɂȂINVALID_HANDLE
+*//*****************************************/
+int CAnimalSpatialGrid::FindNearest(AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius) const
+{
+	int nNearest = INVALID_HANDLE;
+	float fNearestDistSq = 0.0f;
+
+	ForEachInRadius(eKind, f3Pos, fRadius, [&](const GridEntry& entry, size_t, float fDistSq)
+	{
+		// ꍇ̓nh̏iXVɈˑȂ悤ɂj
+		if (nNearest == INVALID_HANDLE || fDistSq < fNearestDistSq ||
+			(fDistSq == fNearestDistSq && entry.nHandle < nNearest))
+		{
+			nNearest = entry.nHandle;
+			fNearestDistSq = fDistSq;
+		}
+	});
+
+	return nNearest;
+}
+
+/*****************************************//*
+	@brief@	| ͈͓̓̃nh擾
+	@param		| eKindFT̎
+	@param		| f3PosFT̒Sʒu
+	@param		| fRadiusFTa
+	@param		| Out_HandlesF͈͓̓̃nh
+*//*****************************************/
+void CAnimalSpatialGrid::GatherHandles(AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius, std::vector<int>& Out_Handles) const
+{
+	Out_Handles.clear();
+
+	ForEachInRadius(eKind, f3Pos, fRadius, [&](const GridEntry& entry, size_t, float)
+	{
+		Out_Handles.push_back(entry.nHandle);
+	});
+
+	// Z̕тɈˑȂ悤Ƀnhɂ
+	std::sort(Out_Handles.begin(), Out_Handles.end());
+}
+
+/*****************************************//*
+	@brief@	| WZԍ̌vZ
+	@param		| fValueFW
+	@return		| Zԍ
+*//*****************************************/
+int CAnimalSpatialGrid::ToCell(float fValue)
+{
+	return static_cast<int>(std::floor(fValue / CELL_SIZE));
+}
+
+/*****************************************//*
+	@brief@	| ނƃZL[̍쐬
+	@param		| eKindF̎
+	@param		| nCellXFX̃Zԍ
+	@param		| nCellZFZ̃Zԍ
+	@return		| ށAXAZ̏ɕԃL[
+*//*****************************************/
+uint64_t CAnimalSpatialGrid::MakeKey(AnimalKind eKind, int nCellX, int nCellZ)
+{
+	const uint64_t nX = static_cast<uint64_t>(nCellX + CELL_OFFSET) & CELL_MASK;
+	const uint64_t nZ = static_cast<uint64_t>(nCellZ + CELL_OFFSET) & CELL_MASK;
+	return (static_cast<uint64_t>(eKind) << (CELL_BITS * 2)) | (nX << CELL_BITS) | nZ;
+}
@@ -0,0 +1,143 @@
+/**************************************************//*
+	@file	| AnimalSpatialGrid.h
+	@brief	| ̋ԃObhht@C
+	@note	| ̈ʒuXZʂ̈lObhɖt[o^A
+			| 씼a̓̓߂ɏ܂Ŏ擾
+			| o^ɍėpȂnh𔭍sAWI̒ǐՂɎg
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include "BoidsSteering.h"
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+// O錾
+class CAnimal;
+
+// @brief Q铮̎
+enum class AnimalKind
+{
+	Wolf,	// T
+	Deer,	// 
+};
+
+// @brief ̋ԃObhNX
+class CAnimalSpatialGrid : public ISingleton<CAnimalSpatialGrid>
+{
+public:
+	// @brief Obh1Z̑傫
+	static constexpr float CELL_SIZE = 10.0f;
+
+	// @brief 1̂擾ߗׂ̓̍ő吔
+	static constexpr size_t MAX_NEIGHBORS = 16;
+
+	// @brief ȃnh
+	static constexpr int INVALID_HANDLE = -1;
+
+private:
+	// @brief RXgN^
+	CAnimalSpatialGrid();
+
+	friend class ISingleton<CAnimalSpatialGrid>;
+
+public:
+	// @brief fXgN^
+	~CAnimalSpatialGrid();
+
+	// @brief ̓o^
+	// @param pAnimalFo^铮
+	// @param eKindF̎ށiނ̓ߗׂƂĈj
+	// @return ̃nhio^̓ɍėpȂj
+	int Register(CAnimal* pAnimal, AnimalKind eKind);
+
+	// @brief ̓o^
+	// @param nHandleFo^铮̃nh
+	void Unregister(int nHandle);
+
+	// @brief nh瓮̎擾
+	// @param nHandleF̃nh
+	// @return Ao^ς݂Ȃnullptr
+	CAnimal* FindAnimal(int nHandle) const;
+
+	// @brief Obh̍č\z
+	// @note t[̍XVOɌĂяoAS̈ʒuExEWIL^
+	//       QɏW񂳂Ă铮͋L^Ȃ̂ŁAߗׂWIƂĒTȂ
+	void Rebuild();
+
+	// @brief ߗׂ̓̎擾
+	// @param nSelfHandleF擾铮g̃nhiʂ珜Oj
+	// @param eKindF̎
+	// @param f3PosFT̒Sʒu
+	// @param fRadiusFTa
+	// @param Out_NeighborsFߗׂ̓i߂MAX_NEIGHBORS܂Łj
+	// @note č\z͋L^ǂނȂ̂ŁÃXbh瓯ɌĂяo
+	void GatherNeighbors(int nSelfHandle, AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius, std::vector<BoidsNeighbor>& Out_Neighbors) const;
+
+	// @brief ͈͓ōł߂̎擾
+	// @param eKindFT̎
+	// @param f3PosFT̒Sʒu
+	// @param fRadiusFTa
+	// @return ł߂̃nhA͈͓ɂȂINVALID_HANDLE
+	// @note TaɊ|Z𒲂ׂ
+	int FindNearest(AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius) const;
+
+	// @brief ͈͓̓̃nh擾
+	// @param eKindFT̎
+	// @param f3PosFT̒Sʒu
+	// @param fRadiusFTa
+	// @param Out_HandlesF͈͓̓̃nhinhj
+	// @note ʒu͍č\z̋L^Ȃ̂ŁAjς݂̓̃nh܂܂꓾iFindAnimalŊmFj
+	void GatherHandles(AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius, std::vector<int>& Out_Handles) const;
+
+	// @brief č\zɋL^̐iQɏW񂳂Ă铮͊܂܂Ȃj
+	size_t GetActiveAnimalCount() const { return m_pActiveAnimals.size(); }
+
+	// @brief č\zɋL^̎擾
+	// @param nIndexFCfbNX
+	CAnimal* GetActiveAnimal(size_t nIndex) const { return m_pActiveAnimals[nIndex]; }
+
+private:
+	// @brief o^ꂽ
+	struct RegisteredAnimal
+	{
+		CAnimal* pAnimal;	// 
+		AnimalKind eKind;	// ̎
+		int nHandle;		// nh
+	};
+
+	// @brief ObhɋL^
+	struct GridEntry
+	{
+		uint64_t nKey;				// ނƃZL[
+		int nHandle;				// ̃nh
+		BoidsNeighbor neighbor;		// L^̈ʒuExEWI
+	};
+
+	// @brief WZԍ̌vZ
+	static int ToCell(float fValue);
+
+	// @brief ނƃZL[̍쐬
+	static uint64_t MakeKey(AnimalKind eKind, int nCellX, int nCellZ);
+
+	// @brief TaɊ|Z̋L^Ƃɏ
+	template<class Func>
+	void ForEachInRadius(AnimalKind eKind, const DirectX::XMFLOAT3& f3Pos, float fRadius, Func func) const;
+
+private:
+	// @brief o^ꂽXg
+	std::vector<RegisteredAnimal> m_Animals;
+
+	// @brief nho^Xg̃CfbNXւ̑Ή
+	std::unordered_map<int, size_t> m_HandleToIndex;
+
+	// @brief ɔsnh
+	int m_nNextHandle;
+
+	// @brief L[ɕׂObh̋L^
+	std::vector<GridEntry> m_Entries;
+
+	// @brief č\zɋL^iXeAOvZ̑Ώہj
+	std::vector<CAnimal*> m_pActiveAnimals;
+};
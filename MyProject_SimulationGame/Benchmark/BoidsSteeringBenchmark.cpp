@@ -0,0 +1,178 @@
+/**************************************************//*
+	@file	| BoidsSteeringBenchmark.cpp
+	@brief	| Boids̃XeAOvŽvvO
+	@note	| ŁiEEÏWߗׂƂ3XMFLOAT3Łj
+			| BoidsSteering::ComputeEComputeSoA𓯂͂ŌJԂĂяoA
+			| 1̂̎ԂƋłƂ̌ʂ̍ő卷\
+			| Q[{̂ɂ͊܂߂AP̂̃R\[vOƂărh
+			|  cl /O2 /EHsc /std:c++17 /I.. BoidsSteeringBenchmark.cpp ..\BoidsSteering.cpp ..\Random.cpp
+*//**************************************************/
+#include "BoidsSteering.h"
+#include "Oparation.h"
+#include "Random.h"
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+
+namespace
+{
+	// @brief v铮̐
+	constexpr int AGENT_NUM = 1024;
+
+	// @brief 1̂̋ߗׂ̐
+	constexpr int NEIGHBOR_NUM = 16;
+
+	// @brief vJԂ
+	constexpr int REPEAT_NUM = 200;
+
+	// @brief ߗׂzú͈i씼a菭Lj
+	constexpr float NEIGHBOR_RANGE = 10.0f;
+
+	// @brief 1̓̕
+	struct Agent
+	{
+		DirectX::XMFLOAT3 f3Pos;
+		DirectX::XMFLOAT3 f3Vel;
+		std::vector<BoidsNeighbor> neighbors;
+		BoidsNeighborSoA neighborsSoA;
+	};
+
+	// @brief ł̃xNg̒𐧌
+	DirectX::XMFLOAT3 ScalarLimit(const DirectX::XMFLOAT3& v, float maxLen)
+	{
+		float len = StructMath::Length(v);
+		if (len > maxLen && len > 0.0001f) return v * (maxLen / len);
+		return v;
+	}
+
+	// @brief łBoids̃XeAO͂̌vZiEEÏWʁXɏWvj
+	DirectX::XMFLOAT3 ScalarCompute(const DirectX::XMFLOAT3& selfPos, const DirectX::XMFLOAT3& selfVel, const std::vector<BoidsNeighbor>& neighbors, const BoidsParams& params)
+	{
+		// 
+		DirectX::XMFLOAT3 sep{ 0,0,0 };
+		int nSepCount = 0;
+		for (const BoidsNeighbor& nb : neighbors)
+		{
+			DirectX::XMFLOAT3 toMe = selfPos - nb.v3Position;
+			float dist = StructMath::Length(toMe);
+			if (dist < params.fSeparationRadius && dist > 0.0001f)
+			{
+				sep += StructMath::Normalize(toMe) * (1.0f / (dist * dist));
+				nSepCount++;
+			}
+		}
+		if (nSepCount > 0) sep = sep * (1.0f / nSepCount);
+
+		// 
+		DirectX::XMFLOAT3 ali{ 0,0,0 };
+		DirectX::XMFLOAT3 avgVel{ 0,0,0 };
+		int nAliCount = 0;
+		for (const BoidsNeighbor& nb : neighbors)
+		{
+			if (StructMath::Length(selfPos - nb.v3Position) < params.fViewRadius)
+			{
+				avgVel += nb.v3Velocity;
+				nAliCount++;
+			}
+		}
+		if (nAliCount > 0) ali = StructMath::Normalize(avgVel * (1.0f / nAliCount)) * params.fMaxSpeed - selfVel;
+
+		// ÏW
+		DirectX::XMFLOAT3 coh{ 0,0,0 };
+		DirectX::XMFLOAT3 center{ 0,0,0 };
+		int nCohCount = 0;
+		for (const BoidsNeighbor& nb : neighbors)
+		{
+			if (StructMath::Length(selfPos - nb.v3Position) < params.fViewRadius)
+			{
+				center += nb.v3Position;
+				nCohCount++;
+			}
+		}
+		if (nCohCount > 0) coh = StructMath::Normalize(center * (1.0f / nCohCount) - selfPos) * params.fMaxSpeed - selfVel;
+
+		// eXeAO͂𐧌Adݕtč
+		DirectX::XMFLOAT3 force = ScalarLimit(sep, params.fMaxSeparationForce) * params.fWeightSeparation
+			+ ScalarLimit(ali, params.fMaxAlignmentForce) * params.fWeightAlignment
+			+ ScalarLimit(coh, params.fMaxCohesionForce) * params.fWeightCohesion;
+		return ScalarLimit(force, params.fMaxForce);
+	}
+
+	// @brief SĂ̓JԂA1̂̎Ԃv
+	// @param funcF1̏̕iCfbNXj
+	// @return 1̂̃imb
+	template<class Func>
+	double Measure(Func func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int r = 0; r < REPEAT_NUM; ++r)
+		{
+			for (int i = 0; i < AGENT_NUM; ++i) func(i);
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		const double dNs = std::chrono::duration<double, std::nano>(end - start).count();
+		return dNs / (static_cast<double>(AGENT_NUM) * REPEAT_NUM);
+	}
+
+	// @brief 2̌ʂ̍ő卷
+	float MaxError(const std::vector<DirectX::XMFLOAT3>& a, const std::vector<DirectX::XMFLOAT3>& b)
+	{
+		float fMax = 0.0f;
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			fMax = (std::max)({ fMax, std::fabs(a[i].x - b[i].x), std::fabs(a[i].y - b[i].y), std::fabs(a[i].z - b[i].z) });
+		}
+		return fMax;
+	}
+}
+
+/*****************************************//*
+	@brief@	| v̎s
+	@return		| IR[h
+*//*****************************************/
+int main()
+{
+	// ̋ߗגxɎU΂̓f[^쐬
+	Random::CStream random(Random::StreamKind::Global, 0);
+	auto randRange = [&random](float fRange) { return (random.Next01() * 2.0f - 1.0f) * fRange; };
+
+	BoidsParams params;
+	std::vector<Agent> agents(AGENT_NUM);
+	for (Agent& agent : agents)
+	{
+		agent.f3Pos = { randRange(100.0f), 0.0f, randRange(100.0f) };
+		agent.f3Vel = { randRange(params.fMaxSpeed), 0.0f, randRange(params.fMaxSpeed) };
+		agent.neighbors.resize(NEIGHBOR_NUM);
+		for (BoidsNeighbor& nb : agent.neighbors)
+		{
+			nb.v3Position = { agent.f3Pos.x + randRange(NEIGHBOR_RANGE), 0.0f, agent.f3Pos.z + randRange(NEIGHBOR_RANGE) };
+			nb.v3Velocity = { randRange(params.fMaxSpeed), 0.0f, randRange(params.fMaxSpeed) };
+		}
+		agent.neighborsSoA.Assign(agent.neighbors);
+	}
+
+	std::vector<DirectX::XMFLOAT3> scalarOut(AGENT_NUM), computeOut(AGENT_NUM), soaOut(AGENT_NUM);
+
+	const double dScalarNs = Measure([&](int i)
+	{
+		scalarOut[i] = ScalarCompute(agents[i].f3Pos, agents[i].f3Vel, agents[i].neighbors, params);
+	});
+	const double dComputeNs = Measure([&](int i)
+	{
+		computeOut[i] = BoidsSteering::Compute(agents[i].f3Pos, agents[i].f3Vel, agents[i].neighbors, params);
+	});
+	const double dSoANs = Measure([&](int i)
+	{
+		soaOut[i] = BoidsSteering::ComputeSoA(agents[i].f3Pos, agents[i].f3Vel, agents[i].neighborsSoA, params);
+	});
+
+	printf("agents %d x neighbors %d, repeat %d\n", AGENT_NUM, NEIGHBOR_NUM, REPEAT_NUM);
+	printf("scalar     : %.2f ns/agent\n", dScalarNs);
+	printf("Compute    : %.2f ns/agent (max error %g)\n", dComputeNs, MaxError(scalarOut, computeOut));
+	printf("ComputeSoA : %.2f ns/agent (max error %g)\n", dSoANs, MaxError(scalarOut, soaOut));
+
+	return 0;
+}
@@ -6,151 +6,168 @@
 #include "BoidsSteering.h"
 #include "DirectXMath.h"
 #include "Oparation.h"
+#include "SteeringMath.h"
 
-// @brief xNg̒𐧌
+// @brief SIMD[4{̍v
 // @param v xNg
-// @param maxLen ő咷
-static DirectX::XMFLOAT3 Limit(const DirectX::XMFLOAT3& v, float maxLen)
+static float HorizontalSum(DirectX::FXMVECTOR v)
 {
-    float len = StructMath::Length(v);
-    if (len > maxLen && len > 0.0001f)
-        return v * (maxLen / len);
-    return v;
+    DirectX::XMFLOAT4 f4;
+    DirectX::XMStoreFloat4(&f4, v);
+    return f4.x + f4.y + f4.z + f4.w;
 }
 
 /****************************************//*
-	@brief@	| Boids̃XeAO͂vZ
-    @param      | selfPosFg̈ʒu
-    @param      | selfVelFg̑x
+	@brief@	| ߗ׏񃊃XgSoAz쐬
     @param      | neighborsFߗ׏񃊃Xg
-    @param      | paramsFBoidsp[^
-    @return     | XeAOxNg
 *//****************************************/
-DirectX::XMFLOAT3 BoidsSteering::Compute(const DirectX::XMFLOAT3& selfPos, const DirectX::XMFLOAT3& selfVel, const std::vector<BoidsNeighbor>& neighbors, const BoidsParams& params)
+void BoidsNeighborSoA::Assign(const std::vector<BoidsNeighbor>& neighbors)
 {
-	// eXeAO͂̌vZ
-    // 
-    DirectX::XMFLOAT3 sep = Limit(Separation(selfPos, neighbors, params), params.fMaxSeparationForce);
-	// 
-    DirectX::XMFLOAT3 ali = Limit(Alignment(selfPos, selfVel, neighbors, params), params.fMaxAlignmentForce);
-	// ÏW
-    DirectX::XMFLOAT3 coh = Limit(Cohesion(selfPos, selfVel, neighbors, params), params.fMaxCohesionForce);
-
-	// dݕtƍ
-    DirectX::XMFLOAT3 force = sep * params.fWeightSeparation
-               + ali * params.fWeightAlignment
-               + coh * params.fWeightCohesion;
-
-	// ő͂ŐĕԂ
-    return Limit(force, params.fMaxForce);
-}
-
-/****************************************//*
-    @brief@	| XeAO͂vZ
-    @param      | selfPosFg̈ʒu
-    @param      | neighborsFߗ׏񃊃Xg
-    @param      | paramsFBoidsp[^
-    @return     | XeAOxNg
-*//****************************************/
-DirectX::XMFLOAT3 BoidsSteering::Separation(const DirectX::XMFLOAT3& selfPos, const std::vector<BoidsNeighbor>& neighbors, const BoidsParams& params)
-{
-    DirectX::XMFLOAT3 steer{ 0,0,0 };
-    int count = 0;
-
-	// ߗׂBoids[v
-    for (auto& nb : neighbors)
+    nCount = neighbors.size();
+
+	// 4̂ǂݍ߂悤4̔{ɐ؂グA]0Ŗ߂
+    const size_t nPadded = (nCount + 3) & ~static_cast<size_t>(3);
+    fPosX.assign(nPadded, 0.0f);
+    fPosY.assign(nPadded, 0.0f);
+    fPosZ.assign(nPadded, 0.0f);
+    fVelX.assign(nPadded, 0.0f);
+    fVelY.assign(nPadded, 0.0f);
+    fVelZ.assign(nPadded, 0.0f);
+
+    for (size_t i = 0; i < nCount; ++i)
     {
-		// gƂ̋vZ
-        DirectX::XMFLOAT3 toMe = selfPos - nb.v3Position;
-		// aȓȂ甽͂Z
-        float dist = StructMath::Length(toMe);
-		// aȓȂ甽͂Z
-        if (dist < params.fSeparationRadius && dist > 0.0001f)
-        {
-            // ߋŋ悤Ɋ^̓Ō
-            float weight = 1.0f / (dist * dist);
-			// ͂Z
-            steer += StructMath::Normalize(toMe) * weight;
-            count++;
-        }
+        fPosX[i] = neighbors[i].v3Position.x;
+        fPosY[i] = neighbors[i].v3Position.y;
+        fPosZ[i] = neighbors[i].v3Position.z;
+        fVelX[i] = neighbors[i].v3Velocity.x;
+        fVelY[i] = neighbors[i].v3Velocity.y;
+        fVelZ[i] = neighbors[i].v3Velocity.z;
     }
-
-    if (count == 0) return { 0,0,0 };
-    return steer * (1.0f / count);
 }
 
 /****************************************//*
-    @brief@	| XeAO͂vZ
+	@brief@	| Boids̃XeAO͂vZ
     @param      | selfPosFg̈ʒu
     @param      | selfVelFg̑x
     @param      | neighborsFߗ׏񃊃Xg
     @param      | paramsFBoidsp[^
-    @return     | XeAOxNg
+    @return     | XeAOxNg
 *//****************************************/
-DirectX::XMFLOAT3 BoidsSteering::Alignment(const DirectX::XMFLOAT3& selfPos, const DirectX::XMFLOAT3& selfVel, const std::vector<BoidsNeighbor>& neighbors, const BoidsParams& params)
+DirectX::XMFLOAT3 BoidsSteering::Compute(const DirectX::XMFLOAT3& selfPos, const DirectX::XMFLOAT3& selfVel, const std::vector<BoidsNeighbor>& neighbors, const BoidsParams& params)
 {
-    DirectX::XMFLOAT3 avgVel{ 0,0,0 };
-    int count = 0;
+	// lߑւp̔z̓XbhƂɎg
+    thread_local BoidsNeighborSoA soa;
+    soa.Assign(neighbors);
 
-	// ߗׂBoids[v
-    for (auto& nb : neighbors)
-    {
-		// gƂ̋vZ
-        float dist = StructMath::Length(selfPos - nb.v3Position);
-
-		// 씼aȓȂ畽ϑxɉZ
-        if (dist < params.fViewRadius)
-        {
-			// xZ
-            avgVel += nb.v3Velocity;
-            count++;
-        }
-    }
-    if (count == 0) return { 0,0,0 };
-
-	// ϑxvZ
-    avgVel = avgVel * (1.0f / count);
-    DirectX::XMFLOAT3 desired = StructMath::Normalize(avgVel) * params.fMaxSpeed;
-
-    // ݑxƂ̍i{̃ACg̃XeAj
-    return desired - selfVel;
+    return ComputeSoA(selfPos, selfVel, soa, params);
 }
 
 /****************************************//*
-    @brief@	| ÏWXeAO͂vZ
+	@brief@	| Boids̃XeAO͂SoAz񂩂vZ
     @param      | selfPosFg̈ʒu
     @param      | selfVelFg̑x
-    @param      | neighborsFߗ׏񃊃Xg
+    @param      | neighborsFߗ׏SoAz
     @param      | paramsFBoidsp[^
-    @return     | ÏWXeAOxNg
+    @return     | XeAOxNg
+    @note       | 1[ɋߗ1̂蓖āA4̂EEÏWWv
 *//****************************************/
-DirectX::XMFLOAT3 BoidsSteering::Cohesion(const DirectX::XMFLOAT3& selfPos, const DirectX::XMFLOAT3& selfVel, const std::vector<BoidsNeighbor>& neighbors, const BoidsParams& params)
+DirectX::XMFLOAT3 BoidsSteering::ComputeSoA(const DirectX::XMFLOAT3& selfPos, const DirectX::XMFLOAT3& selfVel, const BoidsNeighborSoA& neighbors, const BoidsParams& params)
 {
-    DirectX::XMFLOAT3 center{ 0,0,0 };
-    int count = 0;
+    using namespace DirectX;
+
+	// g̈ʒuƔp̒lS[ɕ
+    const XMVECTOR vSelfX = XMVectorReplicate(selfPos.x);
+    const XMVECTOR vSelfY = XMVectorReplicate(selfPos.y);
+    const XMVECTOR vSelfZ = XMVectorReplicate(selfPos.z);
+    const XMVECTOR vViewRadiusSq = XMVectorReplicate(params.fViewRadius * params.fViewRadius);
+    const XMVECTOR vSeparationRadiusSq = XMVectorReplicate(params.fSeparationRadius * params.fSeparationRadius);
+    const XMVECTOR vMinDistSq = XMVectorReplicate(0.0001f * 0.0001f);
+    const XMVECTOR vCount = XMVectorReplicate(static_cast<float>(neighbors.nCount));
+    const XMVECTOR vLaneOffset = XMVectorSet(0.0f, 1.0f, 2.0f, 3.0f);
+    const XMVECTOR vOne = XMVectorSplatOne();
+    const XMVECTOR vZero = XMVectorZero();
+
+	// EEÏW̏Wv
+    XMVECTOR vSepX = vZero, vSepY = vZero, vSepZ = vZero, vSepCount = vZero;
+    XMVECTOR vVelX = vZero, vVelY = vZero, vVelZ = vZero;
+    XMVECTOR vPosSumX = vZero, vPosSumY = vZero, vPosSumZ = vZero, vViewCount = vZero;
+
+	// ߗׂ4̂1
+    for (size_t i = 0; i < neighbors.nCount; i += 4)
+    {
+        const XMVECTOR vPosX = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&neighbors.fPosX[i]));
+        const XMVECTOR vPosY = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&neighbors.fPosY[i]));
+        const XMVECTOR vPosZ = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&neighbors.fPosZ[i]));
+        const XMVECTOR vNbVelX = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&neighbors.fVelX[i]));
+        const XMVECTOR vNbVelY = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&neighbors.fVelY[i]));
+        const XMVECTOR vNbVelZ = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&neighbors.fVelZ[i]));
+
+		// ̖ߑ̃[O
+        const XMVECTOR vValid = XMVectorLess(XMVectorAdd(XMVectorReplicate(static_cast<float>(i)), vLaneOffset), vCount);
+
+		// ߗׂ玩gւ̃xNgƋ2
+        const XMVECTOR vToMeX = XMVectorSubtract(vSelfX, vPosX);
+        const XMVECTOR vToMeY = XMVectorSubtract(vSelfY, vPosY);
+        const XMVECTOR vToMeZ = XMVectorSubtract(vSelfZ, vPosZ);
+        const XMVECTOR vDistSq = XMVectorMultiplyAdd(vToMeZ, vToMeZ, XMVectorMultiplyAdd(vToMeY, vToMeY, XMVectorMultiply(vToMeX, vToMeX)));
+
+		// 씼aȓȂ琮EÏWAaȓȂ番̑Ώ
+        const XMVECTOR vInView = XMVectorAndInt(vValid, XMVectorLess(vDistSq, vViewRadiusSq));
+        const XMVECTOR vInSeparation = XMVectorAndInt(vValid,
+            XMVectorAndInt(XMVectorLess(vDistSq, vSeparationRadiusSq), XMVectorGreater(vDistSq, vMinDistSq)));
+
+		// FK̓ŌitoMe / dist^3j
+        const XMVECTOR vInvDist = XMVectorReciprocalSqrt(vDistSq);
+        const XMVECTOR vWeight = XMVectorMultiply(vInvDist, XMVectorMultiply(vInvDist, vInvDist));
+        vSepX = XMVectorAdd(vSepX, XMVectorSelect(vZero, XMVectorMultiply(vToMeX, vWeight), vInSeparation));
+        vSepY = XMVectorAdd(vSepY, XMVectorSelect(vZero, XMVectorMultiply(vToMeY, vWeight), vInSeparation));
+        vSepZ = XMVectorAdd(vSepZ, XMVectorSelect(vZero, XMVectorMultiply(vToMeZ, vWeight), vInSeparation));
+        vSepCount = XMVectorAdd(vSepCount, XMVectorSelect(vZero, vOne, vInSeparation));
+
+		// Fx̍v
+        vVelX = XMVectorAdd(vVelX, XMVectorSelect(vZero, vNbVelX, vInView));
+        vVelY = XMVectorAdd(vVelY, XMVectorSelect(vZero, vNbVelY, vInView));
+        vVelZ = XMVectorAdd(vVelZ, XMVectorSelect(vZero, vNbVelZ, vInView));
+
+		// ÏWFʒu̍v
+        vPosSumX = XMVectorAdd(vPosSumX, XMVectorSelect(vZero, vPosX, vInView));
+        vPosSumY = XMVectorAdd(vPosSumY, XMVectorSelect(vZero, vPosY, vInView));
+        vPosSumZ = XMVectorAdd(vPosSumZ, XMVectorSelect(vZero, vPosZ, vInView));
+        vViewCount = XMVectorAdd(vViewCount, XMVectorSelect(vZero, vOne, vInView));
+    }
 
-	// ߗׂBoids[v
-    for (auto& nb : neighbors)
+	// 
+    const XMVECTOR vSelfPos = SteeringMath::Load(selfPos);
+    const XMVECTOR vSelfVel = SteeringMath::Load(selfVel);
+    XMVECTOR sep = vZero;
+    const float fSepCount = HorizontalSum(vSepCount);
+    if (fSepCount > 0.0f)
     {
-		// gƂ̋vZ
-        float dist = StructMath::Length(selfPos - nb.v3Position);
-
-		// 씼aȓȂ璆SʒuɉZ
-        if (dist < params.fViewRadius)
-        {
-			// ʒuZ
-            center += nb.v3Position;
-            count++;
-        }
+        sep = XMVectorScale(XMVectorSet(HorizontalSum(vSepX), HorizontalSum(vSepY), HorizontalSum(vSepZ), 0.0f), 1.0f / fSepCount);
     }
 
-    if (count == 0) return { 0,0,0 };
+	// ƋÏW
+    XMVECTOR ali = vZero;
+    XMVECTOR coh = vZero;
+    const float fViewCount = HorizontalSum(vViewCount);
+    if (fViewCount > 0.0f)
+    {
+        const float fInvCount = 1.0f / fViewCount;
+
+		// ϑx̌֌xƌݑxƂ̍
+        const XMVECTOR avgVel = XMVectorScale(XMVectorSet(HorizontalSum(vVelX), HorizontalSum(vVelY), HorizontalSum(vVelZ), 0.0f), fInvCount);
+        ali = XMVectorSubtract(XMVectorScale(XMVector3Normalize(avgVel), params.fMaxSpeed), vSelfVel);
+
+		// Sʒu֌xƌݑxƂ̍
+        const XMVECTOR center = XMVectorScale(XMVectorSet(HorizontalSum(vPosSumX), HorizontalSum(vPosSumY), HorizontalSum(vPosSumZ), 0.0f), fInvCount);
+        coh = XMVectorSubtract(XMVectorScale(XMVector3Normalize(XMVectorSubtract(center, vSelfPos)), params.fMaxSpeed), vSelfVel);
+    }
 
-	// Sʒu̕ςvZ
-    center = center * (1.0f / count);
-	// S̖]܂xvZ
-    DirectX::XMFLOAT3 desired = StructMath::Normalize(center - selfPos) * params.fMaxSpeed;
+	// eXeAO͂𐧌Adݕtč
+    XMVECTOR force = XMVectorScale(SteeringMath::Limit(sep, params.fMaxSeparationForce), params.fWeightSeparation);
+    force = XMVectorAdd(force, XMVectorScale(SteeringMath::Limit(ali, params.fMaxAlignmentForce), params.fWeightAlignment));
+    force = XMVectorAdd(force, XMVectorScale(SteeringMath::Limit(coh, params.fMaxCohesionForce), params.fWeightCohesion));
 
-    // ݑxƂ̍i{̃Rq[W̃XeAj
-    return desired - selfVel;
+	// ő͂ŐĕԂ
+    return SteeringMath::Store(SteeringMath::Limit(force, params.fMaxForce));
 }
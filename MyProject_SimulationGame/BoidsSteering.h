@@ -47,6 +47,28 @@ struct BoidsNeighbor
 	bool bSetTarget = false;
 	// WIʒu|C^i݂ꍇj
 	DirectX::XMFLOAT3 pTargetPos = { 0.0f, 0.0f, 0.0f };
+	// WI̓̃nhiǐՂĂȂꍇ-1j
+	int nTargetHandle = -1;
+};
+
+// @brief Boids̋ߗ׏SoAz
+// @note ߗׂ̈ʒuƑx𐬕Ƃ̔zɕׁA4̂SIMDł܂Ƃ߂ď
+struct BoidsNeighborSoA
+{
+	// ʒůe
+	std::vector<float> fPosX;
+	std::vector<float> fPosY;
+	std::vector<float> fPosZ;
+	// x̊e
+	std::vector<float> fVelX;
+	std::vector<float> fVelY;
+	std::vector<float> fVelZ;
+	// ߗׂ̐iz4̔{ɐ؂グĊmۂj
+	size_t nCount = 0;
+
+	// @brief ߗ׏񃊃Xg쐬
+	// @param neighbors ߗׂBoids񃊃Xg
+	void Assign(const std::vector<BoidsNeighbor>& neighbors);
 };
 
 // @brief Boids̃XeAONX
@@ -59,6 +81,7 @@ public:
 	// @param neighbors ߗׂBoids񃊃Xg
 	// @param params Boids̃p[^
 	// @return XeAO̓xNg
+	// @note SoAzɋlߑւComputeSoAĂяo
     static DirectX::XMFLOAT3 Compute(
         const DirectX::XMFLOAT3& selfPos,
         const DirectX::XMFLOAT3& selfVel,
@@ -66,41 +89,17 @@ public:
         const BoidsParams& params
     );
 
-private:
-	// @brief XeAO͂vZ
-	// @param selfPos g̈ʒu
-	// @param neighbors ߗׂBoids񃊃Xg
-	// @param params Boids̃p[^
-	// @return XeAO̓xNg
-    static DirectX::XMFLOAT3 Separation(
-        const DirectX::XMFLOAT3& selfPos,
-        const std::vector<BoidsNeighbor>& neighbors,
-        const BoidsParams& params
-    );
-
-	// @brief XeAO͂vZ
-	// @param selfPos g̈ʒu
-	// @param selfVel g̑x
-	// @param neighbors ߗׂBoids񃊃Xg
-	// @param params Boids̃p[^
-	// @return XeAO̓xNg
-    static DirectX::XMFLOAT3 Alignment(
-        const DirectX::XMFLOAT3& selfPos,
-        const DirectX::XMFLOAT3& selfVel,
-        const std::vector<BoidsNeighbor>& neighbors,
-        const BoidsParams& params
-    );
-
-	// @brief ÏWXeAO͂vZ
+	// @brief Boids̃XeAO͂SoAz񂩂vZ
 	// @param selfPos g̈ʒu
 	// @param selfVel g̑x
-	// @param neighbors ߗׂBoids񃊃Xg
+	// @param neighbors ߗׂBoidsSoAz
 	// @param params Boids̃p[^
-	// @return ÏWXeAO̓xNg
-    static DirectX::XMFLOAT3 Cohesion(
+	// @return XeAO̓xNg
+	// @note EEÏWߗ1ŋ2ɂ蔻肵Ă܂Ƃ߂ďWv
+    static DirectX::XMFLOAT3 ComputeSoA(
         const DirectX::XMFLOAT3& selfPos,
         const DirectX::XMFLOAT3& selfVel,
-        const std::vector<BoidsNeighbor>& neighbors,
+        const BoidsNeighborSoA& neighbors,
         const BoidsParams& params
     );
 };
@@ -49,6 +49,7 @@ CBuildObject* CBuildManager::CreateBuildObjectByType(BuildType eType)
 CBuildManager::CBuildManager()
 	: m_BuildRequestList()
 	, m_fCoolTime(0.0f)
+	, m_PositionRandom(Random::StreamKind::BuildPosition, 0)
 {
 }
 
@@ -277,7 +278,7 @@ DirectX::XMINT2 CBuildManager::DecideRandomBuildPosition()
 	if (cells.empty())return DirectX::XMINT2(-1, -1);
 
 	// _ɃZI
-	int randomIndex = rand() % cells.size();
+	int randomIndex = m_PositionRandom.Range(0, static_cast<int>(cells.size()));
 
 	// IZ̃CfbNXԂ
 	return cells[randomIndex]->GetIndex();
@@ -11,6 +11,7 @@
 #include "BuildObject.h"
 #include "Enums.h"
 #include "Main.h"
+#include "Random.h"
 
 // @brief z֌W̊ǗVXeNX
 class CBuildManager : public ISingleton<CBuildManager>
@@ -146,4 +147,7 @@ private:
 	// @note ̈˗󂯂܂ł̑ҋ@
 	float m_fCoolTime = 0.0f;
 
+	// @brief zʒǔɎgXg[
+	Random::CStream m_PositionRandom;
+
 };
@@ -297,71 +297,9 @@ void CBuilder_Job::GatherMaterialsAction()
 	// ړIn֓BĂȂꍇ͏𔲂
 	if (!m_pOwner->MoveToTarget(storageHouses, Human_Move_Speed))return;
 
-	// fގW
-	std::vector<CItem::Material> HasMaterials;
-	// fރXg̃TCYKvfރXg̃TCYɍ킹
-	HasMaterials.resize(requiredMaterials.size());
-
-	// ĂACeXg擾
-	const auto& ownedItems = m_pOwner->GetItemList();
-
-	// fރXg̏
-	if (!ownedItems.empty())
-	{
-		// ĂACeXg猚zfނ݂̂𒊏o
-		for (int i = 0; i < requiredMaterials.size(); i++)
-		{
-			// fރXg𑖍
-			for (const auto& item : ownedItems)
-			{
-				// fރ^Cvvꍇ
-				if (item->GetItemType() == requiredMaterials[i].eItemType)
-				{
-					// fރXgɒǉ
-					HasMaterials[i].eItemType = requiredMaterials[i].eItemType;
-					HasMaterials[i].nRequiredAmount++;
-				}
-			}
-		}
-	}
-
-	// SĂ̑fނW܂ǂ̃tO
-	bool bAllMaterialsGathered = true;
-
-	// KvfރXg[v
-	for (int i = 0;i < requiredMaterials.size(); i++)
-	{
-		// fނsĂ邩ǂ`FbN
-		if (HasMaterials[i].nRequiredAmount < requiredMaterials[i].nRequiredAmount)
-		{
-			// Kv߂
-			int nNeeded = requiredMaterials[i].nRequiredAmount - HasMaterials[i].nRequiredAmount;
-			if (nNeeded <= 0)continue;
-			// fނW
-			for (int n = 0; n < nNeeded; ++n)
-			{
-				// ɂfނo
-				auto Item = storageHouses->TakeOutItem(requiredMaterials[i].eItemType);
-
-				// oꍇ͎W𑝂₷
-				if (Item != nullptr)
-				{
-					m_pOwner->HoldItem(Item);
-					HasMaterials[i].nRequiredAmount--;
-					// o
-					return;
-				}
-				else
-				{
-					// fނȂꍇ̓tO܂
-					bAllMaterialsGathered = false;
-					// [v𔲂
-					break;
-				}
-			}
-
-		}
-	}
+	// sĂfނ𒙑ɂ܂Ƃ߂Ďo
+	// zfނ͗ʂ߁AȂfނĂo镪͐ɊmۂĂ
+	bool bAllMaterialsGathered = WithdrawMaterials(storageHouses, requiredMaterials, true);
 
 	// SĂ̑fނW܂ꍇ͎̏ԂɈڍs
 	if (bAllMaterialsGathered)
@@ -508,10 +446,7 @@ void CBuilder_Job::BuildingAction()
 		CBuildManager::GetInstance()->CompleteBuildRequest(m_pCurrentBuildRequest);
 
 		// ĂACeSĎ
-		while (!m_pOwner->GetItemList().empty())
-		{
-			m_pOwner->TakeOutItem();
-		}
+		m_pOwner->ClearItems();
 
 		// zIuWFNg̃|C^Zbg
 		m_pBuildingObject = nullptr;
@@ -579,10 +514,7 @@ void CBuilder_Job::UpgradingAction()
 		CBuildManager::GetInstance()->CompleteBuildRequest(m_pCurrentBuildRequest);
 
 		// ĂACeSĎ
-		while (!m_pOwner->GetItemList().empty())
-		{
-			m_pOwner->TakeOutItem();
-		}
+		m_pOwner->ClearItems();
 
 		// zIuWFNg̃|C^Zbg
 		m_pBuildingObject = nullptr;
@@ -11,6 +11,7 @@
 *//*****************************************/
 CCollectTarget::CCollectTarget()
 	: m_TargetingID({ "", -1 })
+	, m_bClaimed(false)
 	, m_LinkedCellIndex({ -1, -1 })
 	, m_Status()
 	, m_pHpBillboard{ nullptr }
@@ -81,8 +82,13 @@ void CCollectTarget::SetCreatePos(CFieldCell* cell)
 void CCollectTarget::OnDestroy()
 {
 	// AgĂtB[hZ̎gpԂ
-	CFieldCell* cell = CFieldManager::GetInstance()->GetFieldGrid()->GetFieldCells()[(int)m_LinkedCellIndex.y][(int)m_LinkedCellIndex.x];
-	cell->SetUse(false);
+	// Z[x][y]Ŋi[Ă
+	// jɒTŎQƂȂ悤zuIuWFNgAĐΏۂƂċL^
+	CFieldGrid* pFieldGrid = CFieldManager::GetInstance()->GetFieldGrid();
+	pFieldGrid->ReleaseCell(pFieldGrid->GetFieldCells()[(int)m_LinkedCellIndex.x][(int)m_LinkedCellIndex.y]);
+
+	// \
+	ReleaseClaim();
 
 	// NX̃IuWFNgj̏
 	CGameObject::OnDestroy();
@@ -95,3 +101,28 @@ void CCollectTarget::DecreaseHp(const float damage)
 {
 	m_Status.m_fHp -= damage;
 }
+
+/*****************************************//*
+	@brief@	| \݂
+	@param@	| idF\񂷂Q[IuWFNgID
+	@return		| true:\񐬌 false:ɑ̃IuWFNg\ς
+*//*****************************************/
+bool CCollectTarget::TryClaim(const ObjectID& id)
+{
+	// \̏ꍇ̂ݗ\ς݂ɐ؂ւ
+	bool expected = false;
+	if (!m_bClaimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) return false;
+
+	// \񂵂IuWFNgIDۑ
+	m_TargetingID = id;
+	return true;
+}
+
+/*****************************************//*
+	@brief@	| \
+*//*****************************************/
+void CCollectTarget::ReleaseClaim()
+{
+	m_TargetingID = ObjectID{ "", -1 };
+	m_bClaimed.store(false, std::memory_order_release);
+}
@@ -9,6 +9,10 @@
 #include "FieldManager.h"
 #include "BillboardRenderer.h"
 #include "Item.h"
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 // @brief WΏۃIuWFNgNX
 class CCollectTarget : public CGameObject
@@ -45,8 +49,25 @@ public:
 	// @brief ^[QbgWIɎw肵ĂĂQ[IuWFNgID擾
 	ObjectID GetTargetingID() const { return m_TargetingID; }
 
-	// @brief ^[QbgWIɎw肵ĂĂQ[IuWFNgIDݒ
-	void SetTargetingID(const ObjectID& id) { m_TargetingID = id; }
+	// @brief \݂
+	// @param idF\񂷂Q[IuWFNgID
+	// @return true:\񐬌 false:ɑ̃IuWFNg\ς
+	bool TryClaim(const ObjectID& id);
+
+	// @brief \
+	void ReleaseClaim();
+
+	// @brief \ς݂ǂ擾
+	bool IsClaimed() const { return m_bClaimed.load(std::memory_order_acquire); }
+
+	// @brief \̎WΏۃIuWFNg߂ɕT
+	// @tparam TFTWΏۃIuWFNǧ^
+	// @param In_vPosFʒu
+	// @param In_nMaxCountF擾ő吔
+	// @return ߂ɕ񂾎WΏۃIuWFNg̃|C^Xg
+	// @note tB[hObhZOփOɒTA\ς݂̃Z͂̏œǂݔ΂
+	template<typename T>
+	static std::vector<T*> FindUnclaimedCandidates(const DirectX::XMFLOAT3& In_vPos, const size_t In_nMaxCount);
 
 	// @brief ϋvn炷
 	// @param damageF炷ϋvl
@@ -63,6 +84,9 @@ protected:
 	// @brief ^[QbgWIɎw肵ĂĂQ[IuWFNgID
 	ObjectID m_TargetingID;
 
+	// @brief \ς݃tO
+	std::atomic<bool> m_bClaimed;
+
 	// @brief AgĂtB[hZ̃CfbNX
 	DirectX::XMINT2 m_LinkedCellIndex;
 
@@ -73,3 +97,81 @@ protected:
 	CBillboardRenderer* m_pHpBillboard;
 };
 
+/*****************************************//*
+	@brief@	| \̎WΏۃIuWFNg߂ɕT
+	@param		| In_vPosFʒu
+	@param		| In_nMaxCountF擾ő吔
+	@return		| ߂ɕ񂾎WΏۃIuWFNg̃|C^Xg
+*//*****************************************/
+template<typename T>
+inline std::vector<T*> CCollectTarget::FindUnclaimedCandidates(const DirectX::XMFLOAT3& In_vPos, const size_t In_nMaxCount)
+{
+	std::vector<T*> result;
+
+	CFieldGrid* pGrid = CFieldManager::GetInstance()->GetFieldGrid();
+	if (pGrid == nullptr || In_nMaxCount == 0) return result;
+
+	// QƂŎ󂯎Rs[
+	const auto& cells = pGrid->GetFieldCells();
+
+	// ʒũZ
+	const DirectX::XMINT2 center = pGrid->GetCellIndex(In_vPos);
+
+	// T郊O̍ő唼a
+	const int maxRadius = CFieldGrid::GridSizeX > CFieldGrid::GridSizeY ? CFieldGrid::GridSizeX : CFieldGrid::GridSizeY;
+
+	// i2, |C^j
+	std::vector<std::pair<float, T*>> found;
+
+	for (int r = 0; r <= maxRadius; ++r)
+	{
+		// Or̃Z͊ʒu班ȂƂ(r - 1)ZĂ̂ŁA
+		// Kv̌₪߂őĂΒTł؂
+		if (found.size() >= In_nMaxCount)
+		{
+			const float fRingDist = (r - 1) * CFieldCell::CELL_SIZE.x;
+			std::nth_element(found.begin(), found.begin() + (In_nMaxCount - 1), found.end(),
+				[](const std::pair<float, T*>& a, const std::pair<float, T*>& b) { return a.first < b.first; });
+			if (fRingDist > 0.0f && fRingDist * fRingDist > found[In_nMaxCount - 1].first) break;
+		}
+
+		for (int x = center.x - r; x <= center.x + r; ++x)
+		{
+			if (x < 0 || x >= CFieldGrid::GridSizeX) continue;
+
+			// O̊Ô݂𑖍i㉺[̍sȊO͍E[2Ẑ݁j
+			const bool bEdgeX = (x == center.x - r || x == center.x + r);
+			const int step = bEdgeX ? 1 : (r * 2 > 0 ? r * 2 : 1);
+
+			for (int y = center.y - r; y <= center.y + r; y += step)
+			{
+				if (y < 0 || y >= CFieldGrid::GridSizeY) continue;
+
+				CFieldCell* cell = cells[x][y];
+				if (!cell->IsUse()) continue;
+
+				// \ς݁Ej\̃IuWFNg͓ǂݔ΂
+				T* pTarget = dynamic_cast<T*>(cell->GetObject());
+				if (pTarget == nullptr || pTarget->IsClaimed() || pTarget->IsDestroy()) continue;
+
+				DirectX::XMFLOAT3 objPos = pTarget->GetPos();
+				const float dx = In_vPos.x - objPos.x;
+				const float dy = In_vPos.y - objPos.y;
+				const float dz = In_vPos.z - objPos.z;
+				found.emplace_back(dx * dx + dy * dy + dz * dz, pTarget);
+			}
+		}
+	}
+
+	// ߂ɕׂĕKvԂ
+	std::sort(found.begin(), found.end(),
+		[](const std::pair<float, T*>& a, const std::pair<float, T*>& b) { return a.first < b.first; });
+	if (found.size() > In_nMaxCount) found.resize(In_nMaxCount);
+
+	result.reserve(found.size());
+	for (const auto& candidate : found)
+	{
+		result.push_back(candidate.second);
+	}
+	return result;
+}
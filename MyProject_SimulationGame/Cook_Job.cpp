@@ -175,82 +175,17 @@ void CCook_Job::GatheringMaterialsAction()
 	if (!m_pOwner->MoveToTarget(pStorageHouse, Human_Move_Speed))return;
 
 	// Kvfނ̎擾
-	const std::vector<CItem::Material> requiredMaterials = CookMaterials::GetCookMaterials(m_pRequest->eMealType);
+	const CItem::MaterialSpan requiredMaterials = CookMaterials::GetCookMaterials(m_pRequest->eMealType);
 
-	// fގW
-	std::vector<CItem::Material> HasMaterials;
-	// fރXg̃TCYKvfރXg̃TCYɍ킹
-	HasMaterials.resize(requiredMaterials.size());
-
-	// ĂACeXg擾
-	const std::vector<CItem*> ownedItems = m_pOwner->GetItemList();
-
-	// fރXg̏
-	if (!ownedItems.empty())
-	{
-		// ĂACeXg猚zfނ݂̂𒊏o
-		for (int i = 0; i < requiredMaterials.size(); i++)
-		{
-			// fރXg𑖍
-			for (const auto& item : ownedItems)
-			{
-				// fރ^Cvvꍇ
-				if (item->GetItemType() == requiredMaterials[i].eItemType)
-				{
-					// fރXgɒǉ
-					HasMaterials[i].eItemType = requiredMaterials[i].eItemType;
-					HasMaterials[i].nRequiredAmount++;
-				}
-			}
-		}
-	}
-
-	// SĂ̑fނW܂ǂ̃tO
-	bool bAllMaterialsGathered = true;
-
-	// KvfރXg[v
-	for (int i = 0; i < requiredMaterials.size(); i++)
-	{
-		// fނsĂ邩ǂ`FbN
-		if (HasMaterials[i].nRequiredAmount < requiredMaterials[i].nRequiredAmount)
-		{
-			// Kv߂
-			int nNeeded = requiredMaterials[i].nRequiredAmount - HasMaterials[i].nRequiredAmount;
-			if (nNeeded <= 0)continue;
-			// fނW
-			for (int n = 0; n < nNeeded; ++n)
-			{
-				// ɂfނo
-				auto Item = pStorageHouse->TakeOutItem(requiredMaterials[i].eItemType);
-
-				// oꍇ͎W𑝂₷
-				if (Item != nullptr)
-				{
-					m_pOwner->HoldItem(Item);
-					HasMaterials[i].nRequiredAmount--;
-					// o
-					return;
-				}
-				else
-				{
-					// fނȂꍇ̓tO܂
-					bAllMaterialsGathered = false;
-					// [v𔲂
-					break;
-				}
-			}
-
-		}
-	}
+	// sĂfނ𒙑ɂ܂Ƃ߂Ďo
+	// fނSđꍇ̂ݎoAꕔ܂Ȃ悤ɂ
+	bool bAllMaterialsGathered = WithdrawMaterials(pStorageHouse, requiredMaterials, false);
 
 	// SĂ̑fނW܂ꍇ͎̏ԂɈڍs
 	if (bAllMaterialsGathered)
 	{
 		// ĂACeSĎ
-		while (m_pOwner->HasItem())
-		{
-			m_pOwner->TakeOutItem();
-		}
+		m_pOwner->ClearItems();
 
 		// dԂ𐻍쒆ɕύX
 		m_ePrevState = m_eCurrentState;
@@ -308,11 +243,7 @@ void CCook_Job::TransportingFoodAction()
 	if (!m_pOwner->MoveToTarget(pStorageHouse, Human_Move_Speed))return;
 
 	// ĂACe𒙑ɂɎ[
-	while (m_pOwner->HasItem())
-	{
-		CItem* pItem = m_pOwner->TakeOutItem();
-		pStorageHouse->StoreItem(pItem);
-	}
+	pStorageHouse->StoreAll(m_pOwner->GetInventory());
 
 	// ˗Ԃɂ
 	m_pFoodFactory->CompleteRequest(m_pRequest);
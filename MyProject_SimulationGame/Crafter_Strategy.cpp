@@ -0,0 +1,49 @@
+/**************************************************//*
+	@file	| Crafter_Strategy.cpp
+	@brief	| HEƃNXcppt@C
+	@note	| HEƂ̋ʏ
+			| IJob_Strategyp
+*//**************************************************/
+#include "Crafter_Strategy.h"
+#include "Human.h"
+#include "StorageHouse.h"
+
+/*****************************************//*
+	@brief@	| ɂKvfނ܂Ƃ߂Ďo
+	@param		| pStorageHouseFo̒
+	@param		| requiredMaterialsFKvfރXg
+	@param		| bAllowPartialFtrue:sĂo镪mۂ false:Sđꍇ̂ݎo
+	@return		| true:KvfނSđ false:s
+	@note		| Ă镪sx̌ĂяoŎo
+*//*****************************************/
+bool CCrafter_Strategy::WithdrawMaterials(CStorageHouse* pStorageHouse, const CItem::MaterialSpan& requiredMaterials, const bool bAllowPartial)
+{
+	CItemInventory& inventory = m_pOwner->GetInventory();
+
+	// Ă镪s߂iVsƓŒ蒷̂ߊmۂ͔Ȃj
+	CItem::Recipe missingMaterials{};
+	for (const CItem::Material& material : requiredMaterials)
+	{
+		int nNeeded = material.nRequiredAmount - inventory.GetCount(material.eItemType);
+		if (nNeeded > 0) missingMaterials.Push({ material.eItemType, nNeeded });
+	}
+
+	// ɑSďĂꍇ
+	if (missingMaterials.empty()) return true;
+
+	// ɂꍇ͎oȂ
+	if (pStorageHouse == nullptr) return false;
+
+	// sSĒɂɂ΂܂Ƃ߂Ďo
+	if (pStorageHouse->TakeOutMaterials(missingMaterials, inventory)) return true;
+
+	// mۂȂꍇ͉oȂ
+	if (!bAllowPartial) return false;
+
+	// o镪mۂĂ
+	for (const CItem::Material& material : missingMaterials)
+	{
+		pStorageHouse->TakeOutItems(material.eItemType, material.nRequiredAmount, inventory);
+	}
+	return false;
+}
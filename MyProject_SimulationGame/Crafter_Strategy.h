@@ -6,6 +6,11 @@
 *//**************************************************/
 #pragma once
 #include "Job_Strategy.h"
+#include "Item.h"
+#include <vector>
+
+// O錾
+class CStorageHouse;
 
 // @brief HEƃNX
 class CCrafter_Strategy : public IJob_Strategy
@@ -13,4 +18,13 @@ class CCrafter_Strategy : public IJob_Strategy
 public:
 	// @brief zfXgN^
 	virtual ~CCrafter_Strategy() = default;
+
+protected:
+	// @brief ɂKvfނ܂Ƃ߂Ďo
+	// @param pStorageHouseFo̒
+	// @param requiredMaterialsFKvfރXg
+	// @param bAllowPartialFtrue:sĂo镪mۂ false:Sđꍇ̂ݎo
+	// @return true:KvfނSđ false:s
+	// @note Ă镪sx̌ĂяoŎo
+	bool WithdrawMaterials(CStorageHouse* pStorageHouse, const CItem::MaterialSpan& requiredMaterials, const bool bAllowPartial);
 };
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**************************************************//*
+	@file	| DecisionScheduler.cpp
+	@brief	| lԂ̏ԌXPW[[cppt@C
+	@note	| lԂƂ̏ԁidExeEHǰ𐔃t[ɈxɊԈA
+			| 肷t[lԂƂɂ炵ĕׂ𕪎U
+			| 󕠁E̊JnEEƕύX̃Cxg͑Ɍ肵
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "DecisionScheduler.h"
+#include "Human.h"
+#include <algorithm>
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CDecisionScheduler::CDecisionScheduler()
+	: m_Buckets()
+	, m_WakeList()
+	, m_ProcessingList()
+	, m_nCurrentBucket(0)
+	, m_ePrevDayTime(CGameTimeManager::GetInstance()->GetCurrentDayTime())
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CDecisionScheduler::~CDecisionScheduler()
+{
+}
+
+/*****************************************//*
+	@brief@	| XV
+*//*****************************************/
+void CDecisionScheduler::Update()
+{
+	// ̊JnEI͑SxeƎd؂ւ邽ߑɌ肵
+	CGameTimeManager::DAY_TIME eDayTime = CGameTimeManager::GetInstance()->GetCurrentDayTime();
+	if ((eDayTime == CGameTimeManager::DAY_TIME::NIGHT) != (m_ePrevDayTime == CGameTimeManager::DAY_TIME::NIGHT))
+	{
+		RequestDecisionAll();
+	}
+	m_ePrevDayTime = eDayTime;
+
+	// vꂽlԂ̏Ԃ
+	// i蒆ɗvǉĂ̍XVɉ񂷂ߓւĂ珈j
+	m_ProcessingList.clear();
+	m_ProcessingList.swap(m_WakeList);
+	for (CHuman* pHuman : m_ProcessingList)
+	{
+		pHuman->SetDecisionRequested(false);
+		pHuman->DecideState();
+	}
+
+	// ̃t[S̐lԂ̏Ԃ
+	for (CHuman* pHuman : m_Buckets[m_nCurrentBucket])
+	{
+		pHuman->DecideState();
+	}
+
+	// ̒St[
+	m_nCurrentBucket = (m_nCurrentBucket + 1) % DECISION_INTERVAL_TICK;
+}
+
+/*****************************************//*
+	@brief@	| lԂ̓o^
+	@param		| pHumanFo^l
+*//*****************************************/
+void CDecisionScheduler::Register(CHuman* pHuman)
+{
+	// łl̏ȂSt[Ɋ蓖Ă
+	auto itBucket = std::min_element(std::begin(m_Buckets), std::end(m_Buckets),
+		[](const std::vector<CHuman*>& a, const std::vector<CHuman*>& b) { return a.size() < b.size(); });
+	itBucket->push_back(pHuman);
+
+	// ŏ͎̌̍XVōs
+	RequestDecision(pHuman);
+}
+
+/*****************************************//*
+	@brief@	| lԂ̓o^
+	@param		| pHumanFo^l
+*//*****************************************/
+void CDecisionScheduler::Unregister(CHuman* pHuman)
+{
+	// St[̃Xg폜iԂ͖Ȃ̂ŖƓւj
+	for (std::vector<CHuman*>& bucket : m_Buckets)
+	{
+		auto it = std::find(bucket.begin(), bucket.end(), pHuman);
+		if (it == bucket.end()) continue;
+
+		*it = bucket.back();
+		bucket.pop_back();
+		break;
+	}
+
+	// ̗v폜
+	m_WakeList.erase(std::remove(m_WakeList.begin(), m_WakeList.end(), pHuman), m_WakeList.end());
+}
+
+/*****************************************//*
+	@brief@	| ̍XVŏԂ肵悤v
+	@param		| pHumanFvl
+*//*****************************************/
+void CDecisionScheduler::RequestDecision(CHuman* pHuman)
+{
+	// vς݂ȂdĒǉȂ
+	if (pHuman->IsDecisionRequested()) return;
+
+	pHuman->SetDecisionRequested(true);
+	m_WakeList.push_back(pHuman);
+}
+
+/*****************************************//*
+	@brief@	| SɏԂ̌v
+*//*****************************************/
+void CDecisionScheduler::RequestDecisionAll()
+{
+	for (std::vector<CHuman*>& bucket : m_Buckets)
+	{
+		for (CHuman* pHuman : bucket)
+		{
+			RequestDecision(pHuman);
+		}
+	}
+}
@@ -0,0 +1,82 @@
+/**************************************************//*
+	@file	| DecisionScheduler.h
+	@brief	| lԂ̏ԌXPW[[ht@C
+	@note	| lԂƂ̏ԁidExeEHǰ𐔃t[ɈxɊԈA
+			| 肷t[lԂƂɂ炵ĕׂ𕪎U
+			| 󕠁E̊JnEEƕύX̃Cxg͑Ɍ肵
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include "GameTimeManager.h"
+#include <vector>
+
+// O錾
+class CHuman;
+
+// @brief lԂ̏ԌXPW[[NX
+class CDecisionScheduler : public ISingleton<CDecisionScheduler>
+{
+public:
+	// @brief Ԃ肵Ԋuit[j
+	static constexpr int DECISION_INTERVAL_TICK = 15;
+
+private:
+	// @brief RXgN^
+	CDecisionScheduler();
+
+	friend class ISingleton<CDecisionScheduler>;
+
+public:
+	// @brief fXgN^
+	~CDecisionScheduler();
+
+	// @brief XV
+	// @note ̃t[S̐lԂƁAvꂽlԂ̏Ԃ肷
+	void Update();
+
+	// @brief lԂ̓o^
+	// @param pHumanFo^l
+	// @note łl̏ȂSt[Ɋ蓖āAŏ͎̌̍XVōs
+	void Register(CHuman* pHuman);
+
+	// @brief lԂ̓o^
+	// @param pHumanFo^l
+	void Unregister(CHuman* pHuman);
+
+	// @brief ̍XVŏԂ肵悤v
+	// @param pHumanFvl
+	void RequestDecision(CHuman* pHuman);
+
+	// @brief o^ĂSĂ̐lԂɏs
+	// @param funcFlԂƂ̏iCHuman*j
+	// @note V[Ŝ𑖍ɐlԂ񋓂
+	template<class Func>
+	void ForEachHuman(Func func) const
+	{
+		for (const std::vector<CHuman*>& bucket : m_Buckets)
+		{
+			for (CHuman* pHuman : bucket) func(pHuman);
+		}
+	}
+
+private:
+	// @brief SɏԂ̌v
+	void RequestDecisionAll();
+
+private:
+	// @brief St[Ƃ̐lԃXg
+	std::vector<CHuman*> m_Buckets[DECISION_INTERVAL_TICK];
+
+	// @brief vꂽlԃXg
+	std::vector<CHuman*> m_WakeList;
+
+	// @brief ̑胊Xgit[̊mۂ邽ߕێj
+	std::vector<CHuman*> m_ProcessingList;
+
+	// @brief ̒St[
+	int m_nCurrentBucket;
+
+	// @brief O̍XV̎ԑ
+	CGameTimeManager::DAY_TIME m_ePrevDayTime;
+};
@@ -7,8 +7,8 @@
 #include "Deer_Animal.h"
 #include "FlockEscapeAI.h"
 #include "Main.h"
-#include "CarnivorousAnimal.h"
 #include "Oparation.h"
+#include "SteeringMath.h"
 #include <cstdint>
 #include <algorithm>
 
@@ -41,6 +41,12 @@ CDeer_Animal::CDeer_Animal()
 
 	// WcAI
 	m_pActionAI = new(std::nothrow) CFlockEscapeAI(params);
+
+	// 씼a̎QƂĈ
+	RegisterToSpatialGrid(AnimalKind::Deer, params.fViewRadius);
+
+	// ėpȂnh𗐐̌̔ԍɂ
+	m_Random.SetEntity(static_cast<uint32_t>(m_nAnimalHandle));
 }
 
 /*****************************************//*
@@ -52,16 +58,12 @@ CDeer_Animal::~CDeer_Animal()
 
 /*****************************************//*
 	@brief@	| 0..1̗擾
-	@return		| (0.0f`1.0f)
-	@note		| `@ŗ
+	@return		| (0.0f`1.0f)
+	@note		| ([hV[h, , eBbN)Ō܂̂ōXVɈˑȂ
 *//*****************************************/
 float CDeer_Animal::Rand01()
 {
-	// `@
-	m_uRandSeed = 1664525u * m_uRandSeed + 1013904223u;
-
-	// 24rbggp0.0f`1.0fɐK
-	return static_cast<float>((m_uRandSeed >> 8) &0x00FFFFFF) / static_cast<float>(0x01000000);
+	return m_Random.Next01();
 }
 
 /*****************************************//*
@@ -75,25 +77,6 @@ void CDeer_Animal::Init()
 	// ModelRendererR|[lgݒ
 	GetComponent<CModelRenderer>()->SetKey("Deer");;
 
-	// V[hi̂ƂɈقȂlɂj
-	// IuWFNgIDƏʒunbVl𐶐
-	ObjectID id = GetID();
-	auto p = GetPos();
-	// FNV-1anbV
-	uint32_t h = 2166136261u;
-	// nbV݊֐
-	auto mix = [&h](uint32_t v)
-	{
-		h ^= v;
-		h *= 16777619u;
-	};
-	// 
-	mix(static_cast<uint32_t>(id.m_nSameCount));
-	mix(static_cast<uint32_t>(static_cast<int>(p.x * 1000.0f)));
-	mix(static_cast<uint32_t>(static_cast<int>(p.z * 1000.0f)));
-	// V[hli0͔j
-	m_uRandSeed = (h == 0 ? 1u : h);
-
 	// pj
 	float angle = Rand01() * DirectX::XM_2PI;
 	m_WanderDir = { sinf(angle),0.0f, cosf(angle) };
@@ -126,6 +109,9 @@ void CDeer_Animal::Init()
 *//*****************************************/
 void CDeer_Animal::Update()
 {
+	// QɏW񂳂ĂԂ͌Qꂪ܂Ƃ߂Ĉړ
+	if (IsCollapsed()) return;
+
 	// eNXXV
 	CHerbivorousAnimal::Update();
 
@@ -144,9 +130,8 @@ void CDeer_Animal::Update()
 		}
 	}
 
-	// ʒuƑx擾
-	DirectX::XMFLOAT3 pos = m_tParam.m_f3Pos;
-	DirectX::XMFLOAT3 vel = m_f3Velocity;
+	// x擾i߂܂XMVECTOR̂܂܌vZj
+	DirectX::XMVECTOR vel = SteeringMath::Load(m_f3Velocity);
 
 	// 𒆂ǂmF
 	bool hasThreat = false;
@@ -205,34 +190,34 @@ void CDeer_Animal::Update()
 		m_bIdle = false;
 	}
 
-	// Boids̃XeAO擾
-	DirectX::XMFLOAT3 steer = m_pActionAI->UpdateAI(pos, vel, m_SameAnimalNeighbors);
+	// Boids̃XeAO擾iCAnimalSimulationŌvZς݁j
+	DirectX::XMVECTOR steer = SteeringMath::Load(m_f3Steering);
 
 	// 
 	const float drag = 0.975f;
-	vel = vel * drag;
+	vel = DirectX::XMVectorScale(vel, drag);
 
 	// pjƃWb^[t
 	float wanderStrength = 1.0f;
 	if (hasThreat) wanderStrength = 0.5f;
 
 	// pj
-	DirectX::XMFLOAT3 wander = m_WanderDir * wanderStrength;
+	DirectX::XMVECTOR wander = DirectX::XMVectorScale(SteeringMath::Load(m_WanderDir), wanderStrength);
 
 	// Wb^[
-	DirectX::XMFLOAT3 vXZ = { vel.x,0.0f, vel.z };
+	DirectX::XMVECTOR vXZ = DirectX::XMVectorSetY(vel, 0.0f);
 	// ړ̒擾
-	float vLen = StructMath::Length(vXZ);
+	float vLen = SteeringMath::Length(vXZ);
 	// \ɈړĂƂ̂݃Wb^[t
-	DirectX::XMFLOAT3 jitter{ 0,0,0 };
+	DirectX::XMVECTOR jitter = DirectX::XMVectorZero();
 
 	// ړxxƎ֍ŝŗ}
 	if (vLen >0.05f)
 	{
 		// ړ̒PʃxNg擾
-		DirectX::XMFLOAT3 fwd = StructMath::Normalize(vXZ);
+		DirectX::XMVECTOR fwd = DirectX::XMVector3Normalize(vXZ);
 		// ExNgvZ
-		DirectX::XMFLOAT3 right = { fwd.z, 0.0f, -fwd.x };
+		DirectX::XMVECTOR right = DirectX::XMVectorSet(DirectX::XMVectorGetZ(fwd), 0.0f, -DirectX::XMVectorGetX(fwd), 0.0f);
 
 		// Wb^[g
 		float hz = 0.4f + Rand01() * 1.2f;
@@ -240,7 +225,7 @@ void CDeer_Animal::Update()
 		// Wb^[vZ
 		float phase = Rand01() * DirectX::XM_2PI;
 		float s = sinf(fDeltaTime + phase) * 0.25f;
-		jitter = right * s;
+		jitter = DirectX::XMVectorScale(right, s);
 	}
 
 	// ҋ@͈ړʂ啝Ɍ炷
@@ -249,14 +234,14 @@ void CDeer_Animal::Update()
 	if (!hasThreat && m_bIdle)
 	{
 		moveFactor = 0.15f;
-		wander = wander * 0.0f;
-		jitter = { 0,0,0 };
+		wander = DirectX::XMVectorZero();
+		jitter = DirectX::XMVectorZero();
 	}
 
 	// Wi𒆂͏߁j
 	const float accelScale = hasThreat ? 1.25f : 1.1f;
 	// xXV
-	vel += (steer + wander + jitter) * (fDeltaTime * moveFactor * accelScale);
+	vel = DirectX::XMVectorAdd(vel, DirectX::XMVectorScale(DirectX::XMVectorAdd(DirectX::XMVectorAdd(steer, wander), jitter), fDeltaTime * moveFactor * accelScale));
 
 	// X^~iQƂōőړx𐧌
 	const float staminaMax = (GetMaxStamina() > 0.0f) ? GetMaxStamina() : 1.0f;
@@ -292,20 +277,20 @@ void CDeer_Animal::Update()
 	const float maxMoveSpeed = minMaxSpeed + (baseMaxSpeed - minMaxSpeed) * shaped;
 
 	// ő呬x
-	float speed = StructMath::Length(vel);
+	float speed = SteeringMath::Length(vel);
 
 	// ߎ̓XP[O
 	if (speed > maxMoveSpeed)
 	{
 		// XP[O
-		vel = vel * (maxMoveSpeed / speed);
+		vel = DirectX::XMVectorScale(vel, maxMoveSpeed / speed);
 		speed = maxMoveSpeed;
 	}
 
 	// ҋ@͂ɑx𗎂Ƃ
 	if (!hasThreat && m_bIdle)
 	{
-		vel = vel * 0.65f;
+		vel = DirectX::XMVectorScale(vel, 0.65f);
 	}
 
 	// X^~i/񕜏
@@ -330,7 +315,7 @@ void CDeer_Animal::Update()
 	}
 
 	// xۑ
-	m_f3Velocity = {vel.x, vel.y, vel.z };
+	m_f3Velocity = SteeringMath::Store(vel);
 
 	// ʒuXV
 	m_tParam.m_f3Pos += m_f3Velocity * fDeltaTime;
@@ -387,51 +372,30 @@ void CDeer_Animal::SetThreat()
 		return;
 	}
 
-	// ŋЂ
-	CCarnivorousAnimal* pPredator = GetScene()->GetGameObject<CCarnivorousAnimal>(GetPos());
+	// x͈͓ōł߂HԃObhT
+	CAnimalSpatialGrid* pGrid = CAnimalSpatialGrid::GetInstance();
+	CAnimal* pPredator = pGrid->FindAnimal(pGrid->FindNearest(AnimalKind::Wolf, GetPos(), m_AlertRange));
 	// ȂΏI
 	if (!pPredator) return;
 
-	// ЂƂ̋vZ
-	float dist = StructMath::Distance(GetPos(), pPredator->GetPos());
-	// Ђx͈͓Ȃ瓦Jn
-	if (dist <= m_AlertRange)
-	{
-		// Јʒuݒ
-		pEscapeAI->SetThreatPosition(pPredator->GetPos());
-	}
+	// Јʒuݒ
+	pEscapeAI->SetThreatPosition(pPredator->GetPos());
 }
 
 /*****************************************//*
-	@brief@	| Q̓o^
-	@param@	| In_DeersF̓Xg
+	@brief@	| Q̋ߗ׏̍쐬
+	@return		| ʒuExƌQŋL鋺
 *//*****************************************/
-void CDeer_Animal::RegisterToFlock(std::vector<CDeer_Animal*> In_Deers)
+BoidsNeighbor CDeer_Animal::MakeBoidsNeighbor() const
 {
-	// f[^NA
-	m_SameAnimalNeighbors.clear();
+	BoidsNeighbor neighbor = CHerbivorousAnimal::MakeBoidsNeighbor();
 
-	// Q̓퓮o^
-	for (CDeer_Animal* deer : In_Deers)
+	// Џ񋤗L
+	if (auto* pEscapeAI = dynamic_cast<CFlockEscapeAI*>(m_pActionAI))
 	{
-		// g̓XLbv
-		if (deer == this) continue;
-
-		// AI擾
-		auto* pEscapeAI = dynamic_cast<CFlockEscapeAI*>(deer->m_pActionAI);
-
-		// ߗ׏쐬
-		BoidsNeighbor neighbor;
-		// ʒu
-		neighbor.v3Position = deer->m_tParam.m_f3Pos;
-		// x
-		neighbor.v3Velocity = deer->m_f3Velocity;
-
-		// Џ񋤗L
-		neighbor.bSetTarget = (pEscapeAI != nullptr) ? pEscapeAI->HasThreat() : false;
-		neighbor.pTargetPos = (pEscapeAI != nullptr) ? pEscapeAI->GetThreatPosition() : DirectX::XMFLOAT3(0, 0, 0);
-
-		// Xgɒǉ
-		m_SameAnimalNeighbors.push_back(neighbor);
+		neighbor.bSetTarget = pEscapeAI->HasThreat();
+		neighbor.pTargetPos = pEscapeAI->GetThreatPosition();
 	}
+
+	return neighbor;
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 *//**************************************************/
 #pragma once
 #include "HerbivorousAnimal.h"
+#include "Random.h"
 
 // @brief NX
 class CDeer_Animal final : public CHerbivorousAnimal
@@ -26,9 +27,9 @@ public:
 	// @brief Ђ̐ݒ
 	void SetThreat();
 
-	// @brief Q̓o^
-	// @param In_DeersFXg
-	void RegisterToFlock(std::vector<CDeer_Animal*> In_Deers);
+	// @brief Q̋ߗ׏̍쐬
+	// @return ʒuExƌQŋL鋺
+	BoidsNeighbor MakeBoidsNeighbor() const override;
 
 private:
 
@@ -57,8 +58,8 @@ private:
 	// @brief ҋ@ǂ̃tO
 	bool m_bIdle = false;
 
-	// @brief V[h
-	unsigned int m_uRandSeed =0;
+	// @brief ̂Ƃ̗Xg[i̔ԍ͋ԃObh̃nhj
+	Random::CStream m_Random{ Random::StreamKind::Animal, 0 };
 
 	// @brief Њd`FbN̂߂̃^C}[iSetThreaťĂяoԈj
 	float m_fThreatCheckTimer =0.0f;
@@ -24,6 +24,8 @@ static const float fDeltaTime = 1.0f / fFPS;
 #define SHADER_PATH(path) (ASSET_PATH("Shader/" path))
 // @brief tHgt@CpX
 #define FONT_PATH(path) (ASSET_PATH("Fonts/" path))
+// @brief f[^t@CpX
+#define DATA_PATH(path) (ASSET_PATH("Data/" path))
 
 // 3DԒ`
 #define CMETER(value) (value * 0.01f)
@@ -12,11 +12,7 @@
 *//****************************************/
 CEntity::CEntity()
 	: CGameObject()
-	, m_fHealth(100.0f)
-	, m_fMaxHealth(100.0f)
-	, m_fStamina(Job_Max_Stamina)
-	, m_fMaxStamina(Job_Max_Stamina)
-	, m_fHunger(Max_Hunger)
+	, m_nVitalsHandle(CVitalsManager::GetInstance()->Register(this))
 	, m_isEating(false)
 {
 }
@@ -26,6 +22,8 @@ CEntity::CEntity()
 *//****************************************/
 CEntity::~CEntity()
 {
+	// lǗVXeo^
+	CVitalsManager::GetInstance()->Unregister(m_nVitalsHandle);
 }
 
 /****************************************//* 
@@ -33,13 +31,8 @@ CEntity::~CEntity()
 *//****************************************/
 void CEntity::Update()
 {
-	// ̗͂0ȉȂ玀S
-	if (m_fHealth <= 0.0f)
-	{
-		// IuWFNgj
-		Destroy();
-		return;
-	}
+	// S͐lǗVXesAOnVitalsEventŔj
+	if (IsDead()) return;
 
 	// 󕠏ԂȂ狺Гxグ
 	if (IsWarningHunger())
@@ -50,7 +43,7 @@ void CEntity::Update()
 		// F󕠓x10̏ꍇ
 		//(xl20)-(󕠓x10) = (s10)
 		// [[[[[[[[[[[[[[[
-		float fHungerDeficit = Warning_Hunger - m_fHunger;
+		float fHungerDeficit = Warning_Hunger - GetHunger();
 	}
 
 	// NX̍XV
@@ -73,18 +66,18 @@ int CEntity::Inspecter(bool isEnd)
 	if (ImGui::CollapsingHeader(std::string(u8"[Xe[^X]").c_str()))
 	{
 		// ̗
-		float fMaxHealth = m_fMaxHealth;
-		float fCurrentHealth = m_fHealth;
+		float fMaxHealth = GetMaxHealth();
+		float fCurrentHealth = GetHealth();
 		ImGui::ProgressBar(fCurrentHealth / fMaxHealth, ImVec2(0.0f, 0.0f), u8"̗");
 
 		// 󕠓x
 		float fMaxHunger = Max_Hunger;
-		float fCurrentHunger = m_fHunger;
+		float fCurrentHunger = GetHunger();
 		ImGui::ProgressBar(fCurrentHunger / fMaxHunger, ImVec2(0.0f, 0.0f), u8"󕠓x");
 
 		// X^~i
-		float fMaxStamina = m_fMaxStamina;
-		float fCurrentStamina = m_fStamina;
+		float fMaxStamina = GetMaxStamina();
+		float fCurrentStamina = GetStamina();
 		ImGui::ProgressBar(fCurrentStamina / fMaxStamina, ImVec2(0.0f, 0.0f), u8"X^~i");
 	}
 	
@@ -106,14 +99,8 @@ int CEntity::Inspecter(bool isEnd)
 *//****************************************/
 void CEntity::DecreaseHunger(float fAmount)
 {
-	// 󕠓x
-	m_fHunger -= fAmount;
-
-	// 󕠓x0ɂȂȂ悤ɕ␳
-	if (m_fHunger < 0.0f)
-	{
-		m_fHunger = 0.0f;
-	}
+	// 󕠓xi0ɂȂȂ悤ɕ␳j
+	CVitalsManager::GetInstance()->AddHunger(m_nVitalsHandle, -fAmount);
 }
 
 /****************************************//* 
@@ -122,14 +109,8 @@ void CEntity::DecreaseHunger(float fAmount)
 *//****************************************/
 void CEntity::RecoverHunger(float fAmount)
 {
-	// 󕠓x
-	m_fHunger += fAmount;
-
-	// 󕠓xől𒴂Ȃ悤ɕ␳
-	if (m_fHunger > Max_Hunger)
-	{
-		m_fHunger = Max_Hunger;
-	}
+	// 󕠓x񕜁iől𒴂Ȃ悤ɕ␳j
+	CVitalsManager::GetInstance()->AddHunger(m_nVitalsHandle, fAmount);
 }
 
 /****************************************//* 
@@ -138,14 +119,8 @@ void CEntity::RecoverHunger(float fAmount)
 *//****************************************/
 void CEntity::DecreaseStamina(float fAmount)
 {
-	// X^~i
-	m_fStamina -= fAmount;
-
-	// X^~i0ɂȂȂ悤ɕ␳
-	if (m_fStamina < 0.0f)
-	{
-		m_fStamina = 0.0f;
-	}
+	// X^~ii0ɂȂȂ悤ɕ␳j
+	CVitalsManager::GetInstance()->AddStamina(m_nVitalsHandle, -fAmount);
 }
 
 /****************************************//* 
@@ -154,26 +129,72 @@ void CEntity::DecreaseStamina(float fAmount)
 *//****************************************/
 void CEntity::RecoverStamina(float fAmount)
 {
-	// X^~i
-	m_fStamina += fAmount;
+	// X^~i񕜁iől𒴂Ȃ悤ɕ␳j
+	CVitalsManager::GetInstance()->AddStamina(m_nVitalsHandle, fAmount);
+}
 
-	// X^~iől𒴂Ȃ悤ɕ␳
-	if (m_fStamina > m_fMaxStamina)
+/****************************************//*
+	@brief@	| lCxg̒ʒm
+	@param		| eEventFCxg̎
+*//****************************************/
+void CEntity::OnVitalsEvent(CVitalsManager::VitalsEvent eEvent)
+{
+	switch (eEvent)
 	{
-		m_fStamina = m_fMaxStamina;
+	case CVitalsManager::VitalsEvent::Died:
+		// IuWFNgj
+		Destroy();
+		break;
+	default:
+		break;
 	}
 }
 
+/****************************************//*
+	@brief@	| ő̗͂̐ݒ
+	@param		| fMaxHealthFő̗
+*//****************************************/
+void CEntity::SetMaxHealth(float fMaxHealth)
+{
+	CVitalsManager::GetInstance()->SetMaxHealth(m_nVitalsHandle, fMaxHealth);
+}
+
+/****************************************//*
+	@brief@	| őX^~i̐ݒ
+	@param		| fMaxStaminaFőX^~i
+*//****************************************/
+void CEntity::SetMaxStamina(float fMaxStamina)
+{
+	CVitalsManager::GetInstance()->SetMaxStamina(m_nVitalsHandle, fMaxStamina);
+}
+
+/****************************************//*
+	@brief@	| t[̋󕠓x̎Rʂ̐ݒ
+	@param		| fDecreaseF
+*//****************************************/
+void CEntity::SetHungerDecrease(float fDecrease)
+{
+	CVitalsManager::GetInstance()->SetHungerDecrease(m_nVitalsHandle, fDecrease);
+}
+
+/****************************************//*
+	@brief@	| 󕠓x0ɂȂɉ쎀邩ǂ̐ݒ
+	@param		| bStarvableFtrue:쎀 false:쎀Ȃ
+*//****************************************/
+void CEntity::SetStarvable(bool bStarvable)
+{
+	CVitalsManager::GetInstance()->SetStarvable(m_nVitalsHandle, bStarvable);
+}
+
 /****************************************//*
 	@brief	| _[W󂯂
 	@param	| fDamage : _[W
 *//****************************************/
 void CEntity::TakeDamage(float fDamage)
 {
-	m_fHealth -= fDamage;
-	if (m_fHealth <= 0.0f)
+	CVitalsManager::GetInstance()->AddHealth(m_nVitalsHandle, -fDamage);
+	if (IsDead())
 	{
-		m_fHealth =0.0f;
 		Destroy();
 	}
 }
\ No newline at end of file
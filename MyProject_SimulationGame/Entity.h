@@ -6,6 +6,7 @@
 *//**************************************************/
 #pragma once
 #include "GameObject.h"
+#include "VitalsManager.h"
 
 // @brief ő󕠒l
 constexpr float Max_Hunger = 100.0f;
@@ -20,6 +21,7 @@ constexpr float Natural_Hunger_Decrease = 0.01f;
 constexpr float Job_Max_Stamina = 100.0f;
 
 // @brief GeBeBIuWFNgNX
+// @note ̗́E󕠓xEX^~i͐lǗVXe̔zɕێAnhŎQƂ
 class CEntity : public CGameObject
 {
 public:
@@ -37,16 +39,16 @@ public:
 
 	// @brief 󕠓x^ǂ̎擾
 	// @return true:^ false:^ł͂Ȃ
-	bool IsMaxHunger() const { return m_fHunger >= Max_Hunger; }
+	bool IsMaxHunger() const { return GetHunger() >= Max_Hunger; }
 	// @brief 󕠓xlȏォǂ̎擾
 	// @return true:lȏ false:l
-	bool IsFullHunger() const { return m_fHunger >= Full_Hunger; }
+	bool IsFullHunger() const { return GetHunger() >= Full_Hunger; }
 	// @brief 󕠓xxlȉǂ̎擾
 	// @return true:xlȉ false:xlȏ
-	bool IsWarningHunger() const { return m_fHunger <= Warning_Hunger; }
+	bool IsWarningHunger() const { return GetHunger() <= Warning_Hunger; }
 	// @brief 󕠓x̎擾
 	// @return 󕠓x
-	float GetHunger() const { return m_fHunger; }
+	float GetHunger() const { return CVitalsManager::GetInstance()->GetHunger(m_nVitalsHandle); }
 	// @brief 󕠓x̌
 	// @param fAmountF
 	void DecreaseHunger(float fAmount);
@@ -55,11 +57,11 @@ public:
 	void RecoverHunger(float fAmount);
 
 	// @brief ̗͂̎擾
-	float GetHealth() const { return m_fHealth; }
+	float GetHealth() const { return CVitalsManager::GetInstance()->GetHealth(m_nVitalsHandle); }
 	// @brief ő̗͂̎擾
-	float GetMaxHealth() const { return m_fMaxHealth; }
+	float GetMaxHealth() const { return CVitalsManager::GetInstance()->GetMaxHealth(m_nVitalsHandle); }
 	// @brief SĂ邩ǂ̎擾
-	bool IsDead() const { return m_fHealth <= 0.0f; }
+	bool IsDead() const { return GetHealth() <= 0.0f; }
 
 	// @brief _[W󂯂
 	// @param fDamage : _[W
@@ -67,16 +69,16 @@ public:
 
 	// @brief X^~i̎擾
 	// @return X^~il
-	float GetStamina() const { return m_fStamina; }
+	float GetStamina() const { return CVitalsManager::GetInstance()->GetStamina(m_nVitalsHandle); }
 	// @brief őX^~i̎擾
 	// @return őX^~il
-	float GetMaxStamina() const { return m_fMaxStamina; }
+	float GetMaxStamina() const { return CVitalsManager::GetInstance()->GetMaxStamina(m_nVitalsHandle); }
 	// @brief X^~iő傩ǂ̎擾
 	// @return true:ő false:őł͂Ȃ
-	bool IsMaxStamina() const { return m_fStamina >= m_fMaxStamina; }
+	bool IsMaxStamina() const { return GetStamina() >= GetMaxStamina(); }
 	// @brief X^~i0ǂ̎擾
 	// @return true:0 false:0ł͂Ȃ
-	bool IsZeroStamina() const { return m_fStamina <= 0.0f; }
+	bool IsZeroStamina() const { return GetStamina() <= 0.0f; }
 	// @brief X^~ǐ
 	// @param fAmountF
 	void DecreaseStamina(float fAmount);
@@ -84,19 +86,29 @@ public:
 	// @param fAmountF񕜗
 	void RecoverStamina(float fAmount);
 
+	// @brief lCxg̒ʒm
+	// @param eEventFCxg̎
+	// @note lzGeBeBɂlǗVXeĂ΂
+	virtual void OnVitalsEvent(CVitalsManager::VitalsEvent eEvent);
+
+protected:
+	// @brief ő̗͂̐ݒi̗͂ő܂ŉ񕜁j
+	// @param fMaxHealthFő̗
+	void SetMaxHealth(float fMaxHealth);
+	// @brief őX^~i̐ݒiX^~iő܂ŉ񕜁j
+	// @param fMaxStaminaFőX^~i
+	void SetMaxStamina(float fMaxStamina);
+	// @brief t[̋󕠓x̎Rʂ̐ݒ
+	// @param fDecreaseF
+	void SetHungerDecrease(float fDecrease);
+	// @brief 󕠓x0ɂȂɉ쎀邩ǂ̐ݒ
+	// @param bStarvableFtrue:쎀 false:쎀Ȃ
+	void SetStarvable(bool bStarvable);
+
 protected:
-	// @brief ̗
-	float m_fHealth;
-	// @brief ̗͍ől
-	float m_fMaxHealth;
+	// @brief lǗVXẽnh
+	int m_nVitalsHandle;
 
-	// @brief 󕠓x
-	float m_fHunger;
 	// @brief HtO
 	bool m_isEating;
-
-	// @brief X^~i
-	float m_fStamina;
-	// @brief őX^~i
-	float m_fMaxStamina;
 };
\ No newline at end of file
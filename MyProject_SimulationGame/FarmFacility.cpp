@@ -16,7 +16,8 @@
 *//*****************************************/
 CFarmFacility::CFarmFacility()
 	:CBuildObject()
-	, m_pCropList()
+	, m_CropList()
+	, m_nGrowthLevel(0)
 	, m_pCompletedItemList()
 	, m_fBuildXP(0.0f)
 {
@@ -27,6 +28,11 @@ CFarmFacility::CFarmFacility()
 *//*****************************************/
 CFarmFacility::~CFarmFacility()
 {
+	// ̔_앨𐶎YisǗVXe폜
+	if (!m_CropList.empty())
+	{
+		CProductionManager::GetInstance()->RemoveProductions(this);
+	}
 }
 
 /*****************************************//*
@@ -59,11 +65,16 @@ void CFarmFacility::Update()
 	// NX̍XV
 	CBuildObject::Update();
 
-	// _앨̐i߂
-	ProgressCrops();
-
-	// _앨i[
-	StoreCompletedCrops();
+	// _앨̐x͐YisǗVXeKvȎɌvZ邽߁A
+	// ł͌zxςxXVi\ČvZj
+	if (m_nGrowthLevel != m_nBuildLevel)
+	{
+		m_nGrowthLevel = m_nBuildLevel;
+		if (!m_CropList.empty())
+		{
+			CProductionManager::GetInstance()->SetRate(this, GetCropGrowthProgressAmount());
+		}
+	}
 }
 
 /*****************************************//*
@@ -78,11 +89,12 @@ int CFarmFacility::Inspecter()
 
 	// _앨Xg̕\
 	ImGui::Text(u8":");
-	for (const auto& crop : m_pCropList)
+	CProductionManager* pProductionManager = CProductionManager::GetInstance();
+	for (const auto& crop : m_CropList)
 	{
 		ImGui::BulletText(u8": %s, isx: %.2f%%",
 			CItem::ITEM_TYPE_TO_STRING(crop.eCropType).c_str(),
-			crop.fGrowthProgress);
+			pProductionManager->GetProgress(crop.nProductionHandle));
 		itemCount++;
 	}
 
@@ -106,7 +118,7 @@ int CFarmFacility::Inspecter()
 bool CFarmFacility::CanAddCrop() const
 {
 	// ݂̔_앨ő_앨łΒǉ\
-	return m_pCropList.size() < MAX_CROP_FARM[m_nBuildLevel - 1];
+	return m_CropList.size() < MAX_CROP_FARM[m_nBuildLevel - 1];
 }
 
 /*****************************************//*
@@ -118,11 +130,15 @@ void CFarmFacility::AddCrop(CItem::ITEM_TYPE eCropType)
 	// ACe^CvłȂΏI
 	if (CItem::GetItemCategoryFromType(eCropType) != CItem::ITEM_CATEGORY::Seed) return;
 
+	// YisǗVXeɐo^
+	int nHandle = CProductionManager::GetInstance()->AddProduction(
+		this, GetCropGrowthProgressAmount(), static_cast<int>(eCropType));
+
 	// _앨\̂𐶐A_앨Xgɒǉ
 	Crop newCrop;
 	newCrop.eCropType = eCropType;
-	newCrop.fGrowthProgress = 0.0f;
-	m_pCropList.push_back(newCrop);
+	newCrop.nProductionHandle = nHandle;
+	m_CropList.push_back(newCrop);
 }
 
 /*****************************************//*
@@ -155,64 +171,49 @@ CItem* CFarmFacility::TakeCompletedCrop()
 }
 
 /*****************************************//*
-	@brief@	| _앨i[
+	@brief@	| Y̒ʒm
+	@param		| nHandleFỸnh
+	@param		| nUserDataF̃ACe^Cv
 *//*****************************************/
-void CFarmFacility::StoreCompletedCrops()
+void CFarmFacility::OnProductionCompleted(int nHandle, int nUserData)
 {
-	// _앨XgłΏI
-	if (m_pCropList.empty()) return;
-
-	// _앨Xg𑖍
-	for (auto it = m_pCropList.begin(); it != m_pCropList.end(); )
+	// ̔_앨Xg폜
+	for (size_t i = 0; i < m_CropList.size(); ++i)
 	{
-		// isx100%ȏłΊ
-		if (it->fGrowthProgress >= 100.0f)
-		{
-			// _앨CItemƂĐAXgɒǉ
-			CItem* pCompletedItem = new(std::nothrow) CItem(CropMaterials::GetCropFromSeed(it->eCropType));
-
-			if (pCompletedItem != nullptr)
-			{
-				m_pCompletedItemList.push_back(pCompletedItem);
+		if (m_CropList[i].nProductionHandle != nHandle) continue;
 
-				// zolZ
-				m_fBuildXP += BUILD_XP_AMOUNT; 
-
-				// xɌolZ
-				CCivLevelManager::GetInstance()->AddExp(CCivLevelManager::ExpType::Farming);
-
-				if (m_fBuildXP >= 100.0f)
-				{
-					// zol100ȏłΌz˗ǉ
-					CBuildManager::GetInstance()->AddBuildRequest(CBuildManager::BuildType::FarmFacility);
-
-					m_fBuildXP -= 100.0f; // zolZbg
-				}
-			}
-			// _앨Xg폜
-			it = m_pCropList.erase(it);
-		}
-		else
-		{
-			++it;
-		}
+		m_CropList[i] = m_CropList.back();
+		m_CropList.pop_back();
+		break;
 	}
+
+	// _앨i[
+	StoreCompletedCrop(static_cast<CItem::ITEM_TYPE>(nUserData));
 }
 
 /*****************************************//*
-	@brief@	| _앨̐i߂
+	@brief@	| _앨i[
+	@param		| eSeedTypeF̃ACe^Cv
 *//*****************************************/
-void CFarmFacility::ProgressCrops()
+void CFarmFacility::StoreCompletedCrop(CItem::ITEM_TYPE eSeedType)
 {
-	// _앨XgłΏI
-	if (m_pCropList.empty()) return;
+	// _앨CItemƂĐAXgɒǉ
+	CItem* pCompletedItem = new(std::nothrow) CItem(CropMaterials::GetCropFromSeed(eSeedType));
+	if (pCompletedItem == nullptr) return;
 
-	// isx̎擾
-	float fGrowthAmount = GetCropGrowthProgressAmount();
+	m_pCompletedItemList.push_back(pCompletedItem);
 
-	// _앨Xg𑖍Aisxi߂
-	for (auto& crop : m_pCropList)
+	// zolZ
+	m_fBuildXP += BUILD_XP_AMOUNT;
+
+	// xɌolZ
+	CCivLevelManager::GetInstance()->AddExp(CCivLevelManager::ExpType::Farming);
+
+	if (m_fBuildXP >= 100.0f)
 	{
-		crop.fGrowthProgress += fGrowthAmount;
+		// zol100ȏłΌz˗ǉ
+		CBuildManager::GetInstance()->AddBuildRequest(CBuildManager::BuildType::FarmFacility);
+
+		m_fBuildXP -= 100.0f; // zolZbg
 	}
 }
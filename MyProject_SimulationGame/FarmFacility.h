@@ -7,10 +7,13 @@
 #pragma once
 #include "BuildObject.h"
 #include "Item.h"
+#include "ProductionManager.h"
 #include <list>
+#include <vector>
 
 // @brief _{݃NX
-class CFarmFacility : public CBuildObject
+// @note 앨̐x͐At[ƐxKvȎɌvZAt[̒ʒmŎn
+class CFarmFacility : public CBuildObject, public IProductionListener
 {
 private:
 	// @brief ɔ_ł앨̍ő吔z
@@ -39,7 +42,7 @@ public:
 	struct Crop
 	{
 		CItem::ITEM_TYPE eCropType;		// _앨̃ACe^Cv
-		float fGrowthProgress;			// isx
+		int nProductionHandle;			// YisǗVXẽnh
 	};
 
 public:
@@ -75,18 +78,24 @@ public:
 	// @return _앨CItem|C^Anullptr
 	CItem* TakeCompletedCrop();
 
+	// @brief Y̒ʒm
+	// @param nHandleFỸnh
+	// @param nUserDataF̃ACe^Cv
+	virtual void OnProductionCompleted(int nHandle, int nUserData) override;
+
 private:
 
 	// @brief _앨i[
-	void StoreCompletedCrops();
-
-	// @brief _앨̐i߂
-	void ProgressCrops();
+	// @param eSeedTypeF̃ACe^Cv
+	void StoreCompletedCrop(CItem::ITEM_TYPE eSeedType);
 
 private:
 
-	// @brief _앨Xg
-	std::list<Crop> m_pCropList;
+	// @brief ̔_앨Xg
+	std::vector<Crop> m_CropList;
+
+	// @brief xݒ肵̌zx
+	int m_nGrowthLevel = 0;
 
 	// @brief _앨Xg
 	std::list<CItem*> m_pCompletedItemList;
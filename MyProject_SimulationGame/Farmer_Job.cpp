@@ -156,18 +156,21 @@ void CFarmer_Job::TendingCropsAction()
 	// ɂ擾
 	CStorageHouse* storageHouse = pScene->GetGameObject<CStorageHouse>();
 
-	// ĂACe擾
-	std::list<CItem*> hasSeedItems;
+	// ĂACẽ^Cv擾
+	CItem::ITEM_TYPE eHasSeedType = CItem::ITEM_TYPE::MAX;
 
-	// ACeXg𑖍
-	for (const auto& item : m_pOwner->GetItemList())
+	// JeS[̏ꍇ̂݃ACe^Cv𑖍
+	if (m_pOwner->GetInventory().GetCategoryCount(CItem::ITEM_CATEGORY::Seed) > 0)
 	{
-		// ACȅꍇ
-		if (item->GetItemCategory() == CItem::ITEM_CATEGORY::Seed)
+		for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
 		{
-			// Xgɒǉ
-			hasSeedItems.push_back(item);
-			break;
+			CItem::ITEM_TYPE eType = static_cast<CItem::ITEM_TYPE>(i);
+			// ACȅꍇ
+			if (CItem::GetItemCategoryFromType(eType) == CItem::ITEM_CATEGORY::Seed && m_pOwner->GetItemCount(eType) > 0)
+			{
+				eHasSeedType = eType;
+				break;
+			}
 		}
 	}
 
@@ -176,7 +179,7 @@ void CFarmer_Job::TendingCropsAction()
 	{
 
 		// ĂACeȂꍇ͏𔲂
-		if (hasSeedItems.empty())
+		if (eHasSeedType == CItem::ITEM_TYPE::MAX)
 		{
 			// qɂɎɍsԂɈڍs
 			m_ePrevState = m_eCurrentState;
@@ -200,7 +203,7 @@ void CFarmer_Job::TendingCropsAction()
 			}
 
 			// ĂACeꍇ
-			if (!hasSeedItems.empty())
+			if (eHasSeedType != CItem::ITEM_TYPE::MAX)
 			{
 				// _{݂앨ǉ\ǂmF
 				if (FarmFacility->CanAddCrop())
@@ -216,11 +219,10 @@ void CFarmer_Job::TendingCropsAction()
 		if (!m_pOwner->MoveToTarget(m_pTargetFarmFacility, Human_Move_Speed))return;
 
 		// ĂACeꍇ
-		if (!hasSeedItems.empty())
+		if (eHasSeedType != CItem::ITEM_TYPE::MAX)
 		{
 			// ڕW{݂ɓA
-			CItem* pSeedItem = hasSeedItems.front();
-			m_pTargetFarmFacility->AddCrop(pSeedItem->GetItemType());
+			m_pTargetFarmFacility->AddCrop(eHasSeedType);
 			// 󕠒l
 			m_pOwner->DecreaseHunger(Work_Hunger_Decrease);
 			// X^~i
@@ -233,7 +235,7 @@ void CFarmer_Job::TendingCropsAction()
 			}
 
 			// ACeXgACe폜
-			m_pOwner->TakeOutItem(pSeedItem->GetItemType());
+			m_pOwner->TakeOutItem(eHasSeedType);
 
 			// ڕW_{݂앨ǉłȂꍇ
 			if (!m_pTargetFarmFacility->CanAddCrop())
@@ -352,7 +354,7 @@ void CFarmer_Job::TransportingCropsAction()
 	if (!m_pOwner->MoveToTarget(storageHouse, Human_Move_Speed))return;
 
 	// qɂɓ珊ĂACe[
-	storageHouse->StoreItem(m_pOwner->TakeOutItem());
+	storageHouse->StoreItem(m_pOwner->GetInventory().TakeAny());
 }
 
 /*****************************************//*
@@ -15,10 +15,13 @@
 CFieldCell::CFieldCell(const DirectX::XMFLOAT3 In_vPos, const DirectX::XMINT2 In_vIndex)
 	: m_eCellType(CellType::EMPTY)
 	, m_eTerritoryType(TerritoryType::NONE)
+	, m_nTerritoryId(-1)
 	, m_bUse(false)
 	, m_vPos(In_vPos)
 	, m_n2Index(In_vIndex)
 	, m_pObject(nullptr)
+	, m_bQueuedInTypeList(false)
+	, m_bQueuedInTerritoryList(false)
 {
 }
 
@@ -60,6 +60,13 @@ public:
 	// @brief ꒣^Cv̐ݒ
 	void SetTerritoryType(const TerritoryType In_eType) { m_eTerritoryType = In_eType; }
 
+	// @brief ꒣ԍ̎擾
+	// @return ꒣ԍA꒣ɑĂȂ-1
+	const int GetTerritoryId() { return m_nTerritoryId; }
+
+	// @brief ꒣ԍ̐ݒ
+	void SetTerritoryId(const int In_nId) { m_nTerritoryId = In_nId; }
+
 	// @brief gptO̎擾iIuWFNgzuĂ邩j
 	const bool IsUse() { return m_bUse; }
 
@@ -78,6 +85,18 @@ public:
 	// @brief zuĂIuWFNg̐ݒ
 	void SetObject(CGameObject* In_pObject) { m_pObject = In_pObject; }
 
+	// @brief Z^Cvʂ̉ς݃Xgɓo^ς݂ǂ
+	const bool IsQueuedInTypeList() { return m_bQueuedInTypeList; }
+
+	// @brief Z^Cvʂ̉ς݃Xgւ̓o^tO̐ݒ
+	void SetQueuedInTypeList(const bool In_bQueued) { m_bQueuedInTypeList = In_bQueued; }
+
+	// @brief ꒣^Cvʂ̉ς݃Xgɓo^ς݂ǂ
+	const bool IsQueuedInTerritoryList() { return m_bQueuedInTerritoryList; }
+
+	// @brief ꒣^Cvʂ̉ς݃Xgւ̓o^tO̐ݒ
+	void SetQueuedInTerritoryList(const bool In_bQueued) { m_bQueuedInTerritoryList = In_bQueued; }
+
 private:
 
 	// @brief ZSʒu
@@ -92,10 +111,19 @@ private:
 	// @brief ꒣^Cv
 	TerritoryType m_eTerritoryType;
 
+	// @brief ꒣ԍi꒣̃Z͓ԍj
+	int m_nTerritoryId;
+
 	// @brief gptO
 	bool m_bUse;
 
 	// @brief zuĂQ[IuWFNgւ̃|C^
 	CGameObject* m_pObject;
+
+	// @brief Z^Cvʂ̉ς݃Xgɓo^ς݃tOido^h~j
+	bool m_bQueuedInTypeList;
+
+	// @brief ꒣^Cvʂ̉ς݃Xgɓo^ς݃tOido^h~j
+	bool m_bQueuedInTerritoryList;
 };
 
@@ -4,6 +4,7 @@
 	@note	| tB[hObhɊǗ
 *//**************************************************/
 #include "FieldGrid.h"
+#include <cmath>
 
 /****************************************//*
 	@brief	| RXgN^
@@ -17,6 +18,9 @@ CFieldGrid::CFieldGrid(const DirectX::XMFLOAT3 In_vPos)
 	StartPos.y = In_vPos.y;
 	StartPos.z = In_vPos.z - (GridSizeY / 2) * CFieldCell::CELL_SIZE.z + CFieldCell::CELL_SIZE.z / 2;
 
+	// WCfbNXtZ邽߂ɐ擪Z̒SWێ
+	m_vOriginPos = StartPos;
+
 	// Xg[WFẐAzŊmۂȀ new/delete 
 	m_cellsStorage.reserve(static_cast<size_t>(GridSizeX) * static_cast<size_t>(GridSizeY));
 	for (int x = 0; x < GridSizeX; ++x)
@@ -84,3 +88,140 @@ std::vector<CFieldCell*> CFieldGrid::GetFieldCells(CFieldCell::CellType In_Type,
 
 	return FieldCells;
 }
+
+/****************************************//*
+	@brief	| [hWZ̃CfbNX擾
+	@param		| In_vPos	: [hW
+	@return		| Z̃CfbNXiObh͈͓Ɋۂߍށj
+*//****************************************/
+DirectX::XMINT2 CFieldGrid::GetCellIndex(const DirectX::XMFLOAT3& In_vPos) const
+{
+	// 擪ZS̋ZTCYŊčł߂Z߂
+	int x = static_cast<int>(floorf((In_vPos.x - m_vOriginPos.x) / CFieldCell::CELL_SIZE.x + 0.5f));
+	int y = static_cast<int>(floorf((In_vPos.z - m_vOriginPos.z) / CFieldCell::CELL_SIZE.z + 0.5f));
+
+	// Obh͈͓Ɋۂߍ
+	if (x < 0) x = 0;
+	if (y < 0) y = 0;
+	if (x >= GridSizeX) x = GridSizeX - 1;
+	if (y >= GridSizeY) y = GridSizeY - 1;
+
+	return DirectX::XMINT2{ x, y };
+}
+
+/****************************************//*
+	@brief	| Z̎gpAς݃ZƂċL^
+	@param		| pCell	: Z
+*//****************************************/
+void CFieldGrid::ReleaseCell(CFieldCell* pCell)
+{
+	if (pCell == nullptr) return;
+
+	// gpԂƔzuIuWFNg
+	pCell->SetUse(false);
+	pCell->SetObject(nullptr);
+
+	// ̐ΏۂƂċL^
+	QueueFreedCell(pCell);
+}
+
+/****************************************//*
+	@brief	| ݖgp̑SZς݃ZƂċL^
+*//****************************************/
+void CFieldGrid::ResetFreedCells()
+{
+	// L^NA
+	for (auto& list : m_FreedCellsByType) list.clear();
+	for (auto& list : m_FreedCellsByTerritory) list.clear();
+	for (CFieldCell& cell : m_cellsStorage)
+	{
+		cell.SetQueuedInTypeList(false);
+		cell.SetQueuedInTerritoryList(false);
+	}
+
+	// gp̃ZSċL^
+	for (CFieldCell& cell : m_cellsStorage)
+	{
+		if (!cell.IsUse()) QueueFreedCell(&cell);
+	}
+}
+
+/****************************************//*
+	@brief	| O̎擾ȍ~ɉꂽgpZ擾
+	@param		| In_Type	: Z^Cv
+	@return		| gpwZ^CṽZ
+*//****************************************/
+std::vector<CFieldCell*> CFieldGrid::TakeFreedCells(CFieldCell::CellType In_Type)
+{
+	std::vector<CFieldCell*> FieldCells;
+	if (In_Type == CFieldCell::CellType::MAX) return FieldCells;
+
+	std::vector<CFieldCell*>& freedCells = m_FreedCellsByType[static_cast<int>(In_Type)];
+	FieldCells.reserve(freedCells.size());
+
+	for (CFieldCell* cell : freedCells)
+	{
+		cell->SetQueuedInTypeList(false);
+
+		// L^ɍĎgpꂽA܂̓^CvςZ͏O
+		if (cell->GetCellType() == In_Type && !cell->IsUse())
+		{
+			FieldCells.push_back(cell);
+		}
+	}
+	freedCells.clear();
+
+	return FieldCells;
+}
+
+/****************************************//*
+	@brief	| O̎擾ȍ~ɉꂽgpZ擾
+	@param		| In_Type	: ꒣^Cv
+	@return		| gpw꒣^CṽZ
+*//****************************************/
+std::vector<CFieldCell*> CFieldGrid::TakeFreedCells(CFieldCell::TerritoryType In_Type)
+{
+	std::vector<CFieldCell*> FieldCells;
+	if (static_cast<int>(In_Type) >= static_cast<int>(CFieldCell::TerritoryType::MAX)) return FieldCells;
+
+	std::vector<CFieldCell*>& freedCells = m_FreedCellsByTerritory[static_cast<int>(In_Type)];
+	FieldCells.reserve(freedCells.size());
+
+	for (CFieldCell* cell : freedCells)
+	{
+		cell->SetQueuedInTerritoryList(false);
+
+		// L^ɍĎgpꂽA܂͓꒣肪ςZ͏O
+		if (cell->GetTerritoryType() == In_Type && !cell->IsUse())
+		{
+			FieldCells.push_back(cell);
+		}
+	}
+	freedCells.clear();
+
+	return FieldCells;
+}
+
+/****************************************//*
+	@brief	| ς݃ZƂċL^
+	@param		| pCell	: L^Z
+	@note		| ZƂɓo^ς݃tO߁AXg̑傫̓Z𒴂Ȃ
+*//****************************************/
+void CFieldGrid::QueueFreedCell(CFieldCell* pCell)
+{
+	// Z^CvʂɋL^
+	int nType = static_cast<int>(pCell->GetCellType());
+	if (nType < static_cast<int>(CFieldCell::CellType::MAX) && !pCell->IsQueuedInTypeList())
+	{
+		m_FreedCellsByType[nType].push_back(pCell);
+		pCell->SetQueuedInTypeList(true);
+	}
+
+	// ꒣^CvʂɋL^
+	int nTerritory = static_cast<int>(pCell->GetTerritoryType());
+	if (nTerritory < static_cast<int>(CFieldCell::TerritoryType::MAX) && !pCell->IsQueuedInTerritoryList())
+	{
+		m_FreedCellsByTerritory[nTerritory].push_back(pCell);
+		pCell->SetQueuedInTerritoryList(true);
+	}
+}
@@ -41,11 +41,49 @@ public:
 	// @param In_UseFtrue:gp̃Z擾 false:gp̃Z擾
 	std::vector<CFieldCell*> GetFieldCells(CFieldCell::CellType In_Type, bool In_Use);
 
+	// @brief [hWZ̃CfbNX擾
+	// @param In_vPosF[hW
+	// @return Z̃CfbNXiObh͈͓Ɋۂߍށj
+	DirectX::XMINT2 GetCellIndex(const DirectX::XMFLOAT3& In_vPos) const;
+
+	// @brief Z̎gpAς݃ZƂċL^
+	// @param pCellFZ
+	// @note WFl[^[͎̐ɉς݃ZQƂ
+	void ReleaseCell(CFieldCell* pCell);
+
+	// @brief ݖgp̑SZς݃ZƂċL^
+	// @note tB[h̃^CvIoA̐OɌĂ
+	void ResetFreedCells();
+
+	// @brief O̎擾ȍ~ɉꂽgpZ擾
+	// @param In_TypeFZ^Cv
+	// @return gpwZ^CṽZi擾͋L^NAj
+	std::vector<CFieldCell*> TakeFreedCells(CFieldCell::CellType In_Type);
+
+	// @brief O̎擾ȍ~ɉꂽgpZ擾
+	// @param In_TypeF꒣^Cv
+	// @return gpw꒣^CṽZi擾͋L^NAj
+	std::vector<CFieldCell*> TakeFreedCells(CFieldCell::TerritoryType In_Type);
+
 private:
+	// @brief ς݃ZƂċL^
+	// @param pCellFL^Z
+	void QueueFreedCell(CFieldCell* pCell);
+
+private:
+	// @brief 擪ZiCfbNX{0,0}j̒SW
+	DirectX::XMFLOAT3 m_vOriginPos;
+
 	// @brief tB[hZ2zi|C^zÂ m_cellsStorage ɘAi[j
 	std::vector<std::vector<CFieldCell*>> m_pFieldCells;
 
 	// @brief Ẑꊇi[ĒP̃AP[Vɂ邱Ƃőʂ new/delete 
 	std::vector<CFieldCell> m_cellsStorage;
+
+	// @brief Z^Cvʂ̉ς݃ZXg
+	std::vector<CFieldCell*> m_FreedCellsByType[static_cast<int>(CFieldCell::CellType::MAX)];
+
+	// @brief ꒣^Cvʂ̉ς݃ZXg
+	std::vector<CFieldCell*> m_FreedCellsByTerritory[static_cast<int>(CFieldCell::TerritoryType::MAX)];
 };
 
@@ -41,6 +41,9 @@ constexpr int DEBUG_DRAW_SIZE =50; // DEBUG_DRAW_SIZE x DEBUG_DRAW_SIZE 
 	@brief	 | RXgN^
  *//*****************************************/
 CFieldManager::CFieldManager()
+	: m_pFieldGrid(nullptr)
+	, m_f3TerritoryCenters()
+	, m_PlacementRandom(Random::StreamKind::FieldPlacement, 0)
 {
 	// tB[hObh̐
 	m_pFieldGrid = new(std::nothrow) CFieldGrid({0.0f,0.0f,0.0f });
@@ -70,6 +73,9 @@ void CFieldManager::AssignFieldCellType()
 	// ̔zu
 	CreateInitialVillage();
 
+	// gp̃Z̐ΏۂƂċL^
+	m_pFieldGrid->ResetFreedCells();
+
 	//ʒm
 	CGeneratorManager::GetInstance()->NotifyObservers();
 }
@@ -155,6 +161,9 @@ void CFieldManager::CreateFieldType()
 		pImGui->SetSeed(seed);
 	}
 
+	// n`ƓV[hňȍ~̗߂iV[hȂ瓯ʂɂȂj
+	Random::SetWorldSeed(seed);
+
 	// FBMmCYp[^
 	FbmNoise::Params fbmParams;
 	fbmParams.octaves =10;
@@ -295,6 +304,9 @@ void CFieldManager::CreateTerritory()
 
 	// c̓꒣萔
 	int remainingTerritory = TERRITORY_COUNT /2;
+	// ꒣萶p̗Xg[i[hV[hŌ܂j
+	Random::CStream random(Random::StreamKind::Territory, 0);
+
 	// _ɕ
 	for (int i =0; i < TerritoryType::Max; ++i)
 	{
@@ -306,7 +318,7 @@ void CFieldManager::CreateTerritory()
 		}
 
 		// _ɓ꒣萔
-		int randNum = rand() % (remainingTerritory +1);
+		int randNum = random.Range(0, remainingTerritory +1);
 
 		// ꒣萔i[
 		territoryNum.push_back(randNum);
@@ -325,6 +337,7 @@ void CFieldManager::CreateTerritory()
 
 	// tB[hZ2z擾iRs[j
 	auto& fieldCells = m_pFieldGrid->GetFieldCells();
+	m_f3TerritoryCenters.clear();
 	// e꒣^CvƂɓ꒣쐬
 	for (int t =0; t < territoryNum.size(); ++t)
 	{
@@ -342,8 +355,8 @@ void CFieldManager::CreateTerritory()
 		for (int n =0; n < territoryNum[t]; ++n)
 		{
 			// _ɃtB[hZI
-			int randX = rand() % CFieldGrid::GridSizeX;
-			int randY = rand() % CFieldGrid::GridSizeY;
+			int randX = random.Range(0, CFieldGrid::GridSizeX);
+			int randY = random.Range(0, CFieldGrid::GridSizeY);
 
 			// S10x10͈̔͂̓XLbv
 			if (randX >= (CFieldGrid::GridSizeX /2 -5) && randX <= (CFieldGrid::GridSizeX /2 +5) &&
@@ -362,8 +375,12 @@ void CFieldManager::CreateTerritory()
 			}
 
 			// ꒣̃TCY0`1͈̔͂Ń_Ɍ
-			int territorySizeX = GetRandOfRange(TERRITORY_MINSIZE_X, TERRITORY_MAXSIZE_X);
-			int territorySizeY = GetRandOfRange(TERRITORY_MINSIZE_Y, TERRITORY_MAXSIZE_Y);
+			int territorySizeX = random.Range(TERRITORY_MINSIZE_X, TERRITORY_MAXSIZE_X);
+			int territorySizeY = random.Range(TERRITORY_MINSIZE_Y, TERRITORY_MAXSIZE_Y);
+
+			// ꒣ԍ𔭍sASʒuL^i꒣̓1̌QɂȂj
+			const int territoryId = static_cast<int>(m_f3TerritoryCenters.size());
+			m_f3TerritoryCenters.push_back(fieldCells[randX][randY]->GetPos());
 
 			// createflag ̈ꎞzg킸ɒڊ蓖ĂsiAP[V팸j
 			for (int x =0; x < territorySizeX; ++x)
@@ -377,10 +394,11 @@ void CFieldManager::CreateTerritory()
 					{
 						continue;
 					}
-					int randFlag = rand() %10; //0`9͈̔͂Ń_Ɍ
+					int randFlag = random.Range(0, 10); //0`9͈̔͂Ń_Ɍ
 					if (randFlag >=5) continue;
 					// tB[hZ̓꒣^Cvݒ
 					fieldCells[cellX][cellY]->SetTerritoryType(territoryType);
+					fieldCells[cellX][cellY]->SetTerritoryId(territoryId);
 				}
 			}
 		}
@@ -400,7 +418,7 @@ CBuildObject* CFieldManager::CreateAndPlaceBuilding(std::vector<CFieldCell*>& ce
 	CScene* pScene = GetScene();
 
 	// _ɃZI
-	int randomIndex = rand() % cells.size();
+	int randomIndex = m_PlacementRandom.Range(0, static_cast<int>(cells.size()));
 
 	// IuWFNg
 	CBuildObject* pObj = factory(pScene);
@@ -10,6 +10,7 @@
 #include <functional>
 #include "BuildObject.h"
 #include "Scene.h"
+#include "Random.h"
 
 // @brief tB[hǗNX
 class CFieldManager : public ISingleton<CFieldManager>
@@ -34,6 +35,10 @@ public:
 	// @brief tB[hObh̕\
 	void DebugDraw();
 
+	// @brief ꒣̒Sʒu̎擾
+	// @param nTerritoryIdF꒣ԍiCFieldCell::GetTerritoryIdj
+	const DirectX::XMFLOAT3& GetTerritoryCenter(int nTerritoryId) const { return m_f3TerritoryCenters[nTerritoryId]; }
+
 private:
 
 	// @brief tB[h^Cv̍쐬
@@ -56,5 +61,11 @@ private:
 	
 	// @brief tB[hObh̃|C^
 	CFieldGrid* m_pFieldGrid;
+
+	// @brief ꒣ԍƂ̒Sʒu
+	std::vector<DirectX::XMFLOAT3> m_f3TerritoryCenters;
+
+	// @brief ̔zuɎgXg[
+	Random::CStream m_PlacementRandom;
 };
 
@@ -0,0 +1,257 @@
+/**************************************************//*
+	@file	| Flock.cpp
+	@brief	| QNXcppt@C
+	@note	| Q̒SEς̌EL̕WIE_ێ
+			| t[1񂾂XVAQ̑SlQƂ
+			| ϑ҂牓Q1̂̏ẂiSELEEσX^~ijƂĈړ
+*//**************************************************/
+#include "Flock.h"
+#include "Animal.h"
+#include "Oparation.h"
+#include "Defines.h"
+#include <algorithm>
+#include <cmath>
+
+/*****************************************//*
+	@brief@	| RXgN^
+	@param		| eKindFQ铮̎
+	@param		| nTerritoryIdF꒣ԍ
+	@param		| f3HomeF꒣̒S
+	@param		| uFlockIdFQ̔ԍ
+*//*****************************************/
+CFlock::CFlock(AnimalKind eKind, int nTerritoryId, const DirectX::XMFLOAT3& f3Home, uint32_t uFlockId)
+	: m_eKind(eKind)
+	, m_nTerritoryId(nTerritoryId)
+	, m_nMembers()
+	, m_MemberIndex()
+	, m_f3Centroid(f3Home)
+	, m_f3Heading({ 0.0f, 0.0f, 0.0f })
+	, m_f3Home(f3Home)
+	, m_f3PatrolPoint(f3Home)
+	, m_isPatrolPointSet(false)
+	, m_fRepathTimer(0.0f)
+	, m_nTargetHandle(CAnimalSpatialGrid::INVALID_HANDLE)
+	, m_Random(Random::StreamKind::Flock, uFlockId)
+	, m_isAggregated(false)
+	, m_fSpreadRadius(0.0f)
+	, m_fMeanStamina(0.0f)
+	, m_fMeanMaxStamina(0.0f)
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CFlock::~CFlock()
+{
+}
+
+/*****************************************//*
+	@brief@	| Q̏WvƏ_̍XV
+	@note		| o[ɔႷ鏈ŁAo[m̑͂Ȃ
+*//*****************************************/
+void CFlock::Update()
+{
+	// W񒆂̓o[~Ă̂ŏŴ𓮂
+	if (m_isAggregated) UpdateAggregate();
+	else UpdateMembers();
+
+	UpdatePatrolPoint();
+}
+
+/*****************************************//*
+	@brief@	| o[Ŵɂ܂Ƃ߂
+*//*****************************************/
+void CFlock::Collapse()
+{
+	if (m_isAggregated || m_nMembers.empty()) return;
+
+	CAnimalSpatialGrid* pGrid = CAnimalSpatialGrid::GetInstance();
+
+	// ŐV̒SʒuL蔼aƕσX^~iWv
+	UpdateMembers();
+	float fSpread = 0.0f;
+	float fStaminaSum = 0.0f;
+	float fMaxStaminaSum = 0.0f;
+	int nCount = 0;
+	for (int nHandle : m_nMembers)
+	{
+		CAnimal* pAnimal = pGrid->FindAnimal(nHandle);
+		if (!pAnimal) continue;
+
+		fSpread = (std::max)(fSpread, StructMath::Distance(pAnimal->GetPos(), m_f3Centroid));
+		fStaminaSum += pAnimal->GetStamina();
+		fMaxStaminaSum += pAnimal->GetMaxStamina();
+		nCount++;
+
+		pAnimal->Collapse();
+	}
+	if (nCount == 0) return;
+
+	m_fSpreadRadius = fSpread;
+	m_fMeanStamina = fStaminaSum / static_cast<float>(nCount);
+	m_fMeanMaxStamina = fMaxStaminaSum / static_cast<float>(nCount);
+	m_isAggregated = true;
+
+	// ϑ҂̂Ȃł̎E͍sȂ
+	ClearTarget();
+}
+
+/*****************************************//*
+	@brief@	| Ŵo[ɓWJ
+*//*****************************************/
+void CFlock::Expand()
+{
+	if (!m_isAggregated) return;
+	m_isAggregated = false;
+
+	CAnimalSpatialGrid* pGrid = CAnimalSpatialGrid::GetInstance();
+
+	// o[̕т͎QEEŕς̂ŁAnhɕׂĔzu߂
+	std::vector<int> nSorted = m_nMembers;
+	std::sort(nSorted.begin(), nSorted.end());
+
+	// p̗ōL蔼ả~ɋϓɔzu
+	constexpr float GOLDEN_ANGLE = 2.39996323f;
+	const float fRadius = (std::max)(m_fSpreadRadius, MIN_SPREAD_RADIUS);
+	const float fCount = static_cast<float>(nSorted.size());
+	const DirectX::XMFLOAT3 f3Velocity = m_f3Heading * AGGREGATE_SPEED;
+
+	for (size_t i = 0; i < nSorted.size(); ++i)
+	{
+		CAnimal* pAnimal = pGrid->FindAnimal(nSorted[i]);
+		if (!pAnimal) continue;
+
+		const float fAngle = GOLDEN_ANGLE * static_cast<float>(i);
+		const float fDistance = fRadius * std::sqrt((static_cast<float>(i) + 0.5f) / fCount);
+		DirectX::XMFLOAT3 f3Pos = m_f3Centroid;
+		f3Pos.x += std::cos(fAngle) * fDistance;
+		f3Pos.z += std::sin(fAngle) * fDistance;
+
+		pAnimal->Expand(f3Pos, f3Velocity, m_fMeanStamina);
+	}
+}
+
+/*****************************************//*
+	@brief@	| o[̒Sʒuƕς̌̏Wv
+*//*****************************************/
+void CFlock::UpdateMembers()
+{
+	CAnimalSpatialGrid* pGrid = CAnimalSpatialGrid::GetInstance();
+
+	// Sʒuƕϑx̏Wv
+	DirectX::XMFLOAT3 f3PosSum{ 0.0f, 0.0f, 0.0f };
+	DirectX::XMFLOAT3 f3VelSum{ 0.0f, 0.0f, 0.0f };
+	int nCount = 0;
+	for (int nHandle : m_nMembers)
+	{
+		CAnimal* pAnimal = pGrid->FindAnimal(nHandle);
+		if (!pAnimal) continue;
+
+		f3PosSum += pAnimal->GetPos();
+		f3VelSum += pAnimal->GetVelocity();
+		nCount++;
+	}
+	if (nCount > 0)
+	{
+		m_f3Centroid = f3PosSum * (1.0f / static_cast<float>(nCount));
+		m_f3Heading = StructMath::Normalize(DirectX::XMFLOAT3(f3VelSum.x, 0.0f, f3VelSum.z));
+	}
+
+	// L̕WIjς݁ASA܂͏W񂳂ĂΉ
+	if (HasTarget())
+	{
+		CAnimal* pTarget = pGrid->FindAnimal(m_nTargetHandle);
+		if (!pTarget || pTarget->IsDead() || pTarget->IsCollapsed()) ClearTarget();
+	}
+}
+
+/*****************************************//*
+	@brief@	| Ŵ̈ړ
+	@note		| _ɌăX^~iɉŒSʒu𓮂
+*//*****************************************/
+void CFlock::UpdateAggregate()
+{
+	// x̑Ȃ̂ŃX^~i͉񕜂Ă
+	m_fMeanStamina = (std::min)(m_fMeanStamina + AGGREGATE_STAMINA_RECOVER * fDeltaTime, m_fMeanMaxStamina);
+
+	const DirectX::XMFLOAT3 f3ToPatrol{ m_f3PatrolPoint.x - m_f3Centroid.x, 0.0f, m_f3PatrolPoint.z - m_f3Centroid.z };
+	if (StructMath::Length(f3ToPatrol) < PATROL_REACH)
+	{
+		m_f3Heading = { 0.0f, 0.0f, 0.0f };
+		return;
+	}
+
+	const float fStaminaRate = (m_fMeanMaxStamina > 0.0f) ? std::clamp(m_fMeanStamina / m_fMeanMaxStamina, 0.0f, 1.0f) : 1.0f;
+	m_f3Heading = StructMath::Normalize(f3ToPatrol);
+	m_f3Centroid += m_f3Heading * (AGGREGATE_SPEED * (0.5f + 0.5f * fStaminaRate) * fDeltaTime);
+}
+
+/*****************************************//*
+	@brief@	| _̍XV
+*//*****************************************/
+void CFlock::UpdatePatrolPoint()
+{
+	m_fRepathTimer += fDeltaTime;
+
+	// V_KvmFiݒABA莞Ԍo߁j
+	const bool needNewPoint =
+		!m_isPatrolPointSet ||
+		StructMath::Length(m_f3PatrolPoint - m_f3Centroid) < PATROL_REACH ||
+		m_fRepathTimer >= REPATH_INTERVAL;
+
+	if (needNewPoint)
+	{
+		m_fRepathTimer = 0.0f;
+		m_isPatrolPointSet = true;
+
+		// ꒣̒S烉_ȕɏ_߂
+		DirectX::XMFLOAT3 dir{ m_Random.Next01() * 2.0f - 1.0f, 0.0f, m_Random.Next01() * 2.0f - 1.0f };
+		// ɒ[ɏꍇXɕ␳
+		if (StructMath::Length(dir) < 0.0001f) dir = { 1.0f, 0.0f, 0.0f };
+		m_f3PatrolPoint = m_f3Home + StructMath::Normalize(dir) * PATROL_RADIUS;
+	}
+}
+
+/*****************************************//*
+	@brief@	| o[̒ǉ
+	@param		| nHandleF̃nh
+*//*****************************************/
+void CFlock::AddMember(int nHandle)
+{
+	if (m_MemberIndex.count(nHandle) != 0) return;
+
+	m_MemberIndex[nHandle] = m_nMembers.size();
+	m_nMembers.push_back(nHandle);
+
+	// W񒆂̌QɎQꍇ͎QW񂷂
+	if (!m_isAggregated) return;
+	CAnimal* pAnimal = CAnimalSpatialGrid::GetInstance()->FindAnimal(nHandle);
+	if (!pAnimal) return;
+
+	// σX^~iɎQ̕
+	const float fCount = static_cast<float>(m_nMembers.size());
+	m_fMeanStamina += (pAnimal->GetStamina() - m_fMeanStamina) / fCount;
+	m_fMeanMaxStamina += (pAnimal->GetMaxStamina() - m_fMeanMaxStamina) / fCount;
+	pAnimal->Collapse();
+}
+
+/*****************************************//*
+	@brief@	| o[̍폜
+	@param		| nHandleF̃nh
+*//*****************************************/
+void CFlock::RemoveMember(int nHandle)
+{
+	auto itIndex = m_MemberIndex.find(nHandle);
+	if (itIndex == m_MemberIndex.end()) return;
+
+	// Ԃ͖Ȃ̂ŖƓւč폜
+	const size_t nIndex = itIndex->second;
+	m_MemberIndex.erase(itIndex);
+	const int nLastHandle = m_nMembers.back();
+	m_nMembers.pop_back();
+	if (nLastHandle == nHandle) return;
+
+	m_nMembers[nIndex] = nLastHandle;
+	m_MemberIndex[nLastHandle] = nIndex;
+}
@@ -0,0 +1,172 @@
+/**************************************************//*
+	@file	| Flock.h
+	@brief	| QNXht@C
+	@note	| Q̒SEς̌EL̕WIE_ێ
+			| t[1񂾂XVAQ̑SlQƂ
+			| ϑ҂牓Q1̂̏ẂiSELEEσX^~ijƂĈړ
+*//**************************************************/
+#pragma once
+#include "AnimalSpatialGrid.h"
+#include "Random.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+// @brief QNX
+class CFlock
+{
+public:
+	// @brief RXgN^
+	// @param eKindFQ铮̎
+	// @param nTerritoryIdF꒣ԍ
+	// @param f3HomeF꒣̒S
+	// @param uFlockIdFQ̔ԍi_߂闐̌̔ԍj
+	CFlock(AnimalKind eKind, int nTerritoryId, const DirectX::XMFLOAT3& f3Home, uint32_t uFlockId);
+
+	// @brief fXgN^
+	~CFlock();
+
+	// @brief Q̏WvƏ_̍XV
+	// @note CFlockManager疈t[̃XeAOvZOɌĂ΂
+	void Update();
+
+	// @brief o[̒ǉ
+	// @param nHandleF̃nh
+	void AddMember(int nHandle);
+
+	// @brief o[̍폜
+	// @param nHandleF̃nh
+	// @note nhƂ̈ʒu疖Ɠւč폜̂ŁAo[ɂ炸莞
+	void RemoveMember(int nHandle);
+
+	// @brief o[Ȃǂ
+	bool IsEmpty() const { return m_nMembers.empty(); }
+
+	// @brief ̎ނ̎擾
+	AnimalKind GetKind() const { return m_eKind; }
+
+	// @brief ꒣ԍ̎擾
+	int GetTerritoryId() const { return m_nTerritoryId; }
+
+	// @brief Q̒Sʒu̎擾
+	const DirectX::XMFLOAT3& GetCentroid() const { return m_f3Centroid; }
+
+	// @brief Q̕ς̌̎擾iXZʂ̒PʃxNgA~܂Ăꍇ0j
+	const DirectX::XMFLOAT3& GetHeading() const { return m_f3Heading; }
+
+	// @brief ꒣̒S̎擾
+	const DirectX::XMFLOAT3& GetHomePosition() const { return m_f3Home; }
+
+	// @brief _̎擾
+	const DirectX::XMFLOAT3& GetPatrolPoint() const { return m_f3PatrolPoint; }
+
+	// @brief W񂳂Ă邩ǂ
+	bool IsAggregated() const { return m_isAggregated; }
+
+	// @brief o[Ŵɂ܂Ƃ߂
+	// @note o[͔jɒ~AQ̒Sړ
+	void Collapse();
+
+	// @brief Ŵo[ɓWJ
+	// @note nhɒS̎̌܂ʒu֔zûŁAWJʂ͖񓯂ɂȂ
+	void Expand();
+
+	// @brief o[̎擾
+	size_t GetMemberCount() const { return m_nMembers.size(); }
+
+	// @brief W񎞂̍L蔼a̎擾
+	float GetSpreadRadius() const { return m_fSpreadRadius; }
+
+	// @brief W񎞂̕σX^~i̎擾
+	float GetMeanStamina() const { return m_fMeanStamina; }
+
+	// @brief L̕WI̐ݒ
+	// @param nHandleFWI̓̃nh
+	void SetTarget(int nHandle) { m_nTargetHandle = nHandle; }
+
+	// @brief L̕WỈ
+	void ClearTarget() { m_nTargetHandle = CAnimalSpatialGrid::INVALID_HANDLE; }
+
+	// @brief L̕WI邩ǂ
+	bool HasTarget() const { return m_nTargetHandle != CAnimalSpatialGrid::INVALID_HANDLE; }
+
+	// @brief L̕WĨnh擾
+	int GetTargetHandle() const { return m_nTargetHandle; }
+
+private:
+	// @brief o[̒Sʒuƕς̌̏Wv
+	void UpdateMembers();
+
+	// @brief Ŵ̈ړ
+	void UpdateAggregate();
+
+	// @brief _̍XV
+	void UpdatePatrolPoint();
+
+private:
+	// @brief ̎
+	AnimalKind m_eKind;
+
+	// @brief ꒣ԍ
+	int m_nTerritoryId;
+
+	// @brief o[̃nh
+	std::vector<int> m_nMembers;
+
+	// @brief nhƂm_nMembers̈ʒu
+	std::unordered_map<int, size_t> m_MemberIndex;
+
+	// @brief Q̒Sʒu
+	DirectX::XMFLOAT3 m_f3Centroid;
+
+	// @brief Q̕ς̌
+	DirectX::XMFLOAT3 m_f3Heading;
+
+	// @brief ꒣̒S
+	DirectX::XMFLOAT3 m_f3Home;
+
+	// @brief _
+	DirectX::XMFLOAT3 m_f3PatrolPoint;
+
+	// @brief _邩ǂ
+	bool m_isPatrolPointSet;
+
+	// @brief _̍Č^C}[
+	float m_fRepathTimer;
+
+	// @brief L̕WĨnh
+	int m_nTargetHandle;
+
+	// @brief QꂲƂ̗Xg[
+	Random::CStream m_Random;
+
+	// @brief W񂳂Ă邩ǂ
+	bool m_isAggregated;
+
+	// @brief W񎞂̍L蔼a
+	float m_fSpreadRadius;
+
+	// @brief W񎞂̕σX^~i
+	float m_fMeanStamina;
+
+	// @brief W񎞂̕ύőX^~i
+	float m_fMeanMaxStamina;
+
+	// @brief 񔼌a
+	static constexpr float PATROL_RADIUS = 25.0f;
+
+	// @brief _ɓBƂ݂Ȃ
+	static constexpr float PATROL_REACH = 3.0f;
+
+	// @brief _̍ČԊuibj
+	static constexpr float REPATH_INTERVAL = 4.0f;
+
+	// @brief Ŵ̈ړxiX^~iő厞j
+	static constexpr float AGGREGATE_SPEED = 2.0f;
+
+	// @brief Ŵ̃X^~i񕜗ʁibj
+	static constexpr float AGGREGATE_STAMINA_RECOVER = 2.0f;
+
+	// @brief WJ̍ŏ̍L蔼aio[mdȂȂ悤ɂj
+	static constexpr float MIN_SPREAD_RADIUS = 2.0f;
+};
@@ -35,10 +35,6 @@ public:
 	// @brief 標的解除
 	void ClearTarget() { m_HasTarget = false; }
 
-	// @brief ホーム位置設定
-	// @param pos：ホームの位置
-	void SetHomePosition(const DirectX::XMFLOAT3& pos);
-
 private:
 	// @brief 目標位置へ向かうステアリング計算
 	// @param pos：現在位置
@@ -47,13 +43,7 @@ private:
 	// @param maxSpeed：最大速度
 	// @param maxForce：最大力
 	// @return ステアリングベクトル
-	static DirectX::XMFLOAT3 Seek(const DirectX::XMFLOAT3& pos, const DirectX::XMFLOAT3& vel, const DirectX::XMFLOAT3& target, float maxSpeed, float maxForce);
-	
-	// @brief 0〜1の乱数取得
-	static float Rand01();
-
-	// @brief XZ平面上のランダム単位ベクトル取得
-	static DirectX::XMFLOAT3 RandomDirXZ();
+	static DirectX::XMVECTOR Seek(DirectX::FXMVECTOR pos, DirectX::FXMVECTOR vel, DirectX::FXMVECTOR target, float maxSpeed, float maxForce);
 
 private:
 	// @brief 標的がいるかどうかのフラグ
@@ -61,24 +51,6 @@ private:
 	// @brief 標的位置
 	DirectX::XMFLOAT3 m_TargetPos{ 0.0f, 0.0f, 0.0f };
 
-	// @brief ホーム位置があるかどうかのフラグ
-	bool m_HasHome = false;
-	// @brief ホーム位置
-	DirectX::XMFLOAT3 m_HomePos{ 0.0f, 0.0f, 0.0f };
-
-	// @brief パトロール目標点
-	DirectX::XMFLOAT3 m_PatrolPoint{ 0.0f, 0.0f, 0.0f };
-	// @brief パトロール目標点があるかどうかのフラグ
-	bool m_HasPatrolPoint = false;
-
-	// @brief パトロール半径
-	float m_PatrolRadius = 25.0f;
-	// @brief パトロール到達距離
-	float m_PatrolReach = 3.0f;
-	// @brief パトロール再経路探索間隔
-	float m_RepathInterval = 4.0f;
-	// @brief パトロール再経路探索タイマー
-	float m_RepathTimer = 0.0f;
 	// @brief パトロールシーク重み
 	float m_PatrolSeekWeight = 1.0f;
 };
@@ -34,28 +34,15 @@ void CFlockEscapeAI::SetThreatPosition(const DirectX::XMFLOAT3& pos)
 	 @param		| maxForceFőxNg
 	 @return	| XeAOxNg
 *//*****************************************/
-DirectX::XMFLOAT3 CFlockEscapeAI::Flee(
-	const DirectX::XMFLOAT3& pos,
-	const DirectX::XMFLOAT3& vel,
-	const DirectX::XMFLOAT3& threat,
+DirectX::XMVECTOR CFlockEscapeAI::Flee(
+	DirectX::FXMVECTOR pos,
+	DirectX::FXMVECTOR vel,
+	DirectX::FXMVECTOR threat,
 	float maxSpeed,
 	float maxForce)
 {
-	// Ђ牓xNg
-	DirectX::XMFLOAT3 away = pos - threat;
-
-	// ɒ[ɏꍇ̓[xNgԂ
-	float dist = StructMath::Length(away);
-	if (dist < 0.001f) return { 0,0,0 };
-
-	// Ђ牓闝zxxNg
-	DirectX::XMFLOAT3 desired = StructMath::Normalize(away) * maxSpeed;
-
-	// XeAOxNgvZ
-	DirectX::XMFLOAT3 steer = desired - vel;
-
-	// ő͂ŐĕԂ
-	return Limit(steer, maxForce);
+	// Ђ牓闝zxƂ̍ő͂ŐĕԂ
+	return SteeringMath::SteerToward(DirectX::XMVectorSubtract(pos, threat), vel, maxSpeed, maxForce);
 }
 
 /*****************************************//*
@@ -78,14 +65,17 @@ DirectX::XMFLOAT3 CFlockEscapeAI::UpdateAI(const DirectX::XMFLOAT3& pos, const D
 		params.fWeightAlignment *= m_EscapeAlignmentScale;
 	}
 
-	// {ChXeAǑvZ
-	DirectX::XMFLOAT3 steering = BoidsSteering::Compute(pos, vel, neighbors, params);
+	// {ChXeAǑvZiȍ~XMVECTOR̂܂܌vZAŌ1񂾂߂j
+	DirectX::XMVECTOR steering = SteeringMath::Load(BoidsSteering::Compute(pos, vel, neighbors, params));
 
 	// Ђꍇ
 	if (m_HasThreat)
 	{
+		const DirectX::XMVECTOR vPos = SteeringMath::Load(pos);
+		const DirectX::XMVECTOR vThreat = SteeringMath::Load(m_ThreatPos);
+
 		// ЂƂ̋vZ
-		const float dist = StructMath::Distance(pos, m_ThreatPos);
+		const float dist = SteeringMath::Length(DirectX::XMVectorSubtract(vPos, vThreat));
 
 		// ̋ɉĒ
 		float t = 1.0f - (dist / m_FleeRadius);
@@ -96,9 +86,9 @@ DirectX::XMFLOAT3 CFlockEscapeAI::UpdateAI(const DirectX::XMFLOAT3& pos, const D
 		const float scale = 0.2f + 0.8f * t;
 
 		// XeAOZ
-		steering += Flee(pos, vel, m_ThreatPos, m_BoidsParams.fMaxSpeed, m_BoidsParams.fMaxForce) * (m_FleeWeight * scale);
+		steering = DirectX::XMVectorAdd(steering, DirectX::XMVectorScale(Flee(vPos, SteeringMath::Load(vel), vThreat, m_BoidsParams.fMaxSpeed, m_BoidsParams.fMaxForce), m_FleeWeight * scale));
 	}
 
 	// XeAOxNgԂ
-	return steering;
+	return SteeringMath::Store(steering);
 }
\ No newline at end of file
@@ -69,7 +69,7 @@ private:
 	// @param maxSpeedFő呬x
 	// @param maxForceFőxNg
 	// @return XeAOxNg
-	static DirectX::XMFLOAT3 Flee(const DirectX::XMFLOAT3& pos, const DirectX::XMFLOAT3& vel, const DirectX::XMFLOAT3& threat, float maxSpeed, float maxForce);
+	static DirectX::XMVECTOR Flee(DirectX::FXMVECTOR pos, DirectX::FXMVECTOR vel, DirectX::FXMVECTOR threat, float maxSpeed, float maxForce);
 
 private:
 	// @brief Ђ邩ǂ̃tO
@@ -0,0 +1,152 @@
+/**************************************************//*
+	@file	| FlockManager.cpp
+	@brief	| QǗVXecppt@C
+	@note	| Q̍쐬EQEEƁASĂ̌Q̖t[̍XVs
+			| ꒣Ő܂ꂽ1̌QɂȂ
+			| JƐlԂ牓Q͏Ŵɂ܂Ƃ߁A߂ÂWJ
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "FlockManager.h"
+#include "Defines.h"
+#include "StructMath.h"
+#include "Camera.h"
+#include "Human.h"
+#include "DecisionScheduler.h"
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CFlockManager::CFlockManager()
+	: m_pFlocks()
+	, m_TerritoryFlocks()
+	, m_uNextFlockId(0)
+	, m_fExpandRadius(DEFAULT_EXPAND_RADIUS)
+	, m_fLodTimer(LOD_CHECK_INTERVAL)
+	, m_f3Observers()
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CFlockManager::~CFlockManager()
+{
+	for (CFlock* pFlock : m_pFlocks)
+	{
+		SAFE_DELETE(pFlock);
+	}
+	m_pFlocks.clear();
+	m_TerritoryFlocks.clear();
+}
+
+/*****************************************//*
+	@brief@	| XV
+*//*****************************************/
+void CFlockManager::Update()
+{
+	// WEWJ͌Q̍XVOɍsAt[̈ړɔf
+	UpdateLod();
+
+	for (size_t i = 0; i < m_pFlocks.size();)
+	{
+		// o[̂ȂQ͔jiQƂĂ铮͂Ȃj
+		if (m_pFlocks[i]->IsEmpty())
+		{
+			m_TerritoryFlocks.erase(m_pFlocks[i]->GetTerritoryId());
+			SAFE_DELETE(m_pFlocks[i]);
+			m_pFlocks[i] = m_pFlocks.back();
+			m_pFlocks.pop_back();
+			continue;
+		}
+
+		m_pFlocks[i]->Update();
+		++i;
+	}
+}
+
+/*****************************************//*
+	@brief@	| Qւ̎Q
+	@param		| nHandleFQ铮̃nh
+	@param		| eKindF̎
+	@param		| nTerritoryIdF܂ꂽ꒣̔ԍ
+	@param		| f3HomeF꒣̒S
+	@return		| QQ
+	@note		| ꒣ԍŌQ̂ŁAQ̐Ɋ֌WȂ莞ԂŎQł
+*//*****************************************/
+CFlock* CFlockManager::Join(int nHandle, AnimalKind eKind, int nTerritoryId, const DirectX::XMFLOAT3& f3Home)
+{
+	CFlock*& pFlock = m_TerritoryFlocks[nTerritoryId];
+
+	// ꒣̌Qꂪ܂Γ꒣̒S̒SƂQ
+	if (pFlock == nullptr)
+	{
+		pFlock = new(std::nothrow) CFlock(eKind, nTerritoryId, f3Home, m_uNextFlockId++);
+		if (pFlock == nullptr)
+		{
+			m_TerritoryFlocks.erase(nTerritoryId);
+			return nullptr;
+		}
+		m_pFlocks.push_back(pFlock);
+	}
+
+	pFlock->AddMember(nHandle);
+	return pFlock;
+}
+
+/*****************************************//*
+	@brief@	| Qꂩ̗E
+	@param		| pFlockFEQ
+	@param		| nHandleFE铮̃nh
+*//*****************************************/
+void CFlockManager::Leave(CFlock* pFlock, int nHandle)
+{
+	if (pFlock == nullptr) return;
+	pFlock->RemoveMember(nHandle);
+}
+
+/*****************************************//*
+	@brief@	| ϑ҂̋ɂQ̏WEWJ
+	@note		| lԂ͏ԌXPW[[ɓo^Ă镪QƂAԊuł肷
+*//*****************************************/
+void CFlockManager::UpdateLod()
+{
+	m_fLodTimer += fDeltaTime;
+	if (m_fLodTimer < LOD_CHECK_INTERVAL) return;
+	m_fLodTimer = 0.0f;
+
+	// ϑҁiJƑSĂ̐lԁj̈ʒuW߂
+	m_f3Observers.clear();
+	m_f3Observers.push_back(CCamera::GetInstance()->GetPos());
+	CDecisionScheduler::GetInstance()->ForEachHuman([this](CHuman* pHuman)
+	{
+		m_f3Observers.push_back(pHuman->GetPos());
+	});
+
+	const float fExpandRadiusSq = m_fExpandRadius * m_fExpandRadius;
+	const float fCollapseRadius = m_fExpandRadius * COLLAPSE_RADIUS_RATE;
+	const float fCollapseRadiusSq = fCollapseRadius * fCollapseRadius;
+
+	for (CFlock* pFlock : m_pFlocks)
+	{
+		if (pFlock->IsEmpty()) continue;
+
+		// Q̒Sł߂ϑ҂܂ł̋iXZʁj
+		const DirectX::XMFLOAT3& f3Centroid = pFlock->GetCentroid();
+		float fNearestSq = fCollapseRadiusSq + 1.0f;
+		for (const DirectX::XMFLOAT3& f3Observer : m_f3Observers)
+		{
+			const float fDX = f3Observer.x - f3Centroid.x;
+			const float fDZ = f3Observer.z - f3Centroid.z;
+			fNearestSq = (std::min)(fNearestSq, fDX * fDX + fDZ * fDZ);
+		}
+
+		if (pFlock->IsAggregated())
+		{
+			if (fNearestSq <= fExpandRadiusSq) pFlock->Expand();
+		}
+		else
+		{
+			if (fNearestSq > fCollapseRadiusSq) pFlock->Collapse();
+		}
+	}
+}
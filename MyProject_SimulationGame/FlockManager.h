@@ -0,0 +1,84 @@
+/**************************************************//*
+	@file	| FlockManager.h
+	@brief	| QǗVXeht@C
+	@note	| Q̍쐬EQEEƁASĂ̌Q̖t[̍XVs
+			| ꒣Ő܂ꂽ1̌QɂȂ
+			| JƐlԂ牓Q͏Ŵɂ܂Ƃ߁A߂ÂWJ
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include "Flock.h"
+#include <vector>
+#include <unordered_map>
+
+// @brief QǗVXeNX
+class CFlockManager : public ISingleton<CFlockManager>
+{
+public:
+	// @brief QWJϑҁiJElԁj̊̋
+	static constexpr float DEFAULT_EXPAND_RADIUS = 150.0f;
+
+	// @brief W񂷂鋗̓WJ鋗ɑ΂{iEt߂ŏWƓWJJԂȂ悤ɂj
+	static constexpr float COLLAPSE_RADIUS_RATE = 1.2f;
+
+	// @brief WEWJ̔Ԋuibj
+	static constexpr float LOD_CHECK_INTERVAL = 0.5f;
+
+private:
+	// @brief RXgN^
+	CFlockManager();
+
+	friend class ISingleton<CFlockManager>;
+
+public:
+	// @brief fXgN^
+	~CFlockManager();
+
+	// @brief XV
+	// @note ̃XeAOvZOɌĂяoAo[̂ȂQ͂Ŕj
+	void Update();
+
+	// @brief Qւ̎Q
+	// @param nHandleFQ铮̃nh
+	// @param eKindF̎
+	// @param nTerritoryIdF܂ꂽ꒣̔ԍ
+	// @param f3HomeF꒣̒S
+	// @return QQi꒣̌Qꂪ܂ΐVj
+	CFlock* Join(int nHandle, AnimalKind eKind, int nTerritoryId, const DirectX::XMFLOAT3& f3Home);
+
+	// @brief Qꂩ̗E
+	// @param pFlockFEQ
+	// @param nHandleFE铮̃nh
+	void Leave(CFlock* pFlock, int nHandle);
+
+	// @brief QWJϑ҂̋̐ݒ
+	// @param fRadiusFQ̒S̋ȓȂWJ
+	void SetExpandRadius(float fRadius) { m_fExpandRadius = fRadius; }
+
+	// @brief QWJϑ҂̋̎擾
+	float GetExpandRadius() const { return m_fExpandRadius; }
+
+private:
+	// @brief ϑ҂̋ɂQ̏WEWJ
+	void UpdateLod();
+
+private:
+	// @brief QꃊXg
+	std::vector<CFlock*> m_pFlocks;
+
+	// @brief ꒣ԍQւ̑Ή
+	std::unordered_map<int, CFlock*> m_TerritoryFlocks;
+
+	// @brief ɍQ̔ԍiQ̗̌̔ԍɎgj
+	uint32_t m_uNextFlockId;
+
+	// @brief QWJϑ҂̋
+	float m_fExpandRadius;
+
+	// @brief WEWJ̔^C}[
+	float m_fLodTimer;
+
+	// @brief ϑ҂̈ʒui育ƂɏWߒj
+	std::vector<DirectX::XMFLOAT3> m_f3Observers;
+};
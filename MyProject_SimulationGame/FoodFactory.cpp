@@ -20,7 +20,16 @@ CFoodFactory::CFoodFactory()
 	:CBuildObject()
 	, m_vCookRequestList()
 	, m_fBuildXP(0.0f)
+	, m_pStorageHouse(nullptr)
+	, m_aMealMaterials()
+	, m_aMealReady()
+	, m_bPlanDirty(false)
 {
+	// Ƃ̍ޗXgx擾Ă
+	for (int i = 0; i < PRODUCIBLE_MEAL_NUM; ++i)
+	{
+		m_aMealMaterials[i] = CookMaterials::GetCookMaterials(PRODUCIBLE_MEAL_TYPES[i]);
+	}
 }
 
 /*****************************************//*
@@ -28,6 +37,8 @@ CFoodFactory::CFoodFactory()
 *//*****************************************/
 CFoodFactory::~CFoodFactory()
 {
+	// ɂ̊Ď
+	WatchStorageHouse(nullptr);
 }
 
 /*****************************************//*
@@ -51,6 +62,8 @@ void CFoodFactory::Init()
 	// sNZVF[_[̐ݒ
 	pModelRenderer->SetPixelShader(pShaderManager->GetPixelShader(PSType::TexColor));
 
+	// ɌĂ钙ɂĎiꍇ͒ɂ̐ɓo^j
+	WatchStorageHouse(GetScene()->GetGameObject<CStorageHouse>());
 }
 
 /*****************************************//*
@@ -64,14 +77,23 @@ void CFoodFactory::Update()
 	// ˗ς̏ꍇ͉Ȃ
 	if (m_vCookRequestList.size() >= MAX_COOK_REQUESTS[m_nBuildLevel - 1]) return;
 
-	// \ȗ̃ACe^CvT
-	CItem::ITEM_TYPE eMealType = FindProducibleMealType();
-
-	// \ȗꍇ͒˗ǉ
-	if (eMealType != CItem::ITEM_TYPE::MAX)
+	// ޗ̏[Ԃωꍇ̂ݒv𗧂Ē
+	if (m_bPlanDirty)
 	{
-		// ˗̒ǉ
-		AddCookRequest(eMealType);
+		// \ȗ̃ACe^CvT
+		CItem::ITEM_TYPE eMealType = FindProducibleMealType();
+
+		// \ȗꍇ͒˗ǉ
+		if (eMealType != CItem::ITEM_TYPE::MAX)
+		{
+			// ˗̒ǉ
+			AddCookRequest(eMealType);
+		}
+		else
+		{
+			// 闿Ȃ̂Ŏ̕ωʒm܂őҋ@
+			m_bPlanDirty = false;
+		}
 	}
 
 	// ݂̌zxő僌xŁAzol100ȏ̏ꍇ
@@ -260,72 +282,122 @@ void CFoodFactory::AddCookRequest(CItem::ITEM_TYPE eMealType)
 /*****************************************//*
 	@brief@	| \ȗT
 	@return		| ꍇ͗̃ACe^CvAȂꍇMAXԂ
+	@note @@	| z̏ = DIɍ闿̏
 *//*****************************************/
-CItem::ITEM_TYPE CFoodFactory::FindProducibleMealType()
+CItem::ITEM_TYPE CFoodFactory::FindProducibleMealType() const
 {
-	// ̃ACe^Cvi[ϐ
-	CItem::ITEM_TYPE eType = CItem::ITEM_TYPE::MAX;
+	// ޗĂ闿D揇ɒT
+	for (int i = 0; i < PRODUCIBLE_MEAL_NUM; ++i)
+	{
+		if (m_aMealReady[i]) return PRODUCIBLE_MEAL_TYPES[i];
+	}
 
-	// ɂ̎擾
-	CStorageHouse* pStorageHouse = GetScene()->GetGameObject<CStorageHouse>();
+	// ȂꍇMAXԂ
+	return CItem::ITEM_TYPE::MAX;
+}
 
-	// \ȗ̃ACe^CvXg擾
-	std::list<CItem::ITEM_TYPE> producibleMealTypes = GetProducibleMealTypes();
+/*****************************************//*
+	@brief@	| [̕ωʒm
+	@param		| pStorageHouseFω
+	@param		| eTypeFωACe^Cv
+	@param		| nCountFω̎[
+	@note		| ޗƂĎgACe̎̂ݏ[ԂXVA
+				| s[ɕωΒv𗧂Ē
+*//*****************************************/
+void CFoodFactory::OnStorageChanged(CStorageHouse* pStorageHouse, const CItem::ITEM_TYPE eType, const int nCount)
+{
+	if (pStorageHouse != m_pStorageHouse) return;
 
-	// \ȗ̃ACe^CvXg𑖍
-	for (const auto& mealType : producibleMealTypes)
+	for (int i = 0; i < PRODUCIBLE_MEAL_NUM; ++i)
 	{
-		// ̕KvޗXg擾
-		auto reqests = CookMaterials::GetCookMaterials(mealType);
+		// ֌ŴȂޗ͖
+		if (!UsesIngredient(i, eType)) continue;
 
-		bool bCanCook = true;
+		bool bReady = IsMealReady(i);
 
-		// KvޗSđĂ邩mF
-		for (const auto& request : reqests)
-		{
-			// ɂɕKvޗȂꍇ͒sƂ
-			if (!pStorageHouse->HasItemType(request.eItemType))
-			{
-				bCanCook = false;
-				break;
-			}
-		}
+		// s[ɕωꍇ͍ĕ]Kv
+		if (bReady && !m_aMealReady[i]) m_bPlanDirty = true;
 
-		// KvޗSđĂꍇ͗̃ACe^CvԂ
-		if (bCanCook)
-		{
-			// ̃ACe^Cvi[
-			eType = mealType;
-			// [v𔲂
-			break;
-		}
+		m_aMealReady[i] = bReady;
 	}
+}
 
-	// ̃ACe^CvԂ
-	return eType;
+/*****************************************//*
+	@brief@	| ɂ̔jʒm
+	@param		| pStorageHouseFj钙
+*//*****************************************/
+void CFoodFactory::OnStorageDestroyed(CStorageHouse* pStorageHouse)
+{
+	if (pStorageHouse != m_pStorageHouse) return;
+
+	// j钙ɂւ̎QƂOi̒ɂ̐ɓo^j
+	m_pStorageHouse = nullptr;
+	m_aMealReady.fill(false);
+	m_bPlanDirty = false;
+}
+
+/*****************************************//*
+	@brief@	| ɂ̐ʒm
+	@param		| pStorageHouseFꂽ
+*//*****************************************/
+void CFoodFactory::OnStorageHouseCreated(CStorageHouse* pStorageHouse)
+{
+	// ɊĎĂ钙ɂꍇ͂̂܂
+	if (m_pStorageHouse != nullptr) return;
+
+	WatchStorageHouse(pStorageHouse);
 }
 
 /*****************************************//*
-	@brief@	| \ȗ̃ACe^CvXg擾
-	@return		| \ȗ̃ACe^CvXg
-	@note @@	| Ȃǂ̓ǉ闿ȂǂŔ
-				| Xgɓ鏇 = DIɍ闿̏
-				|  -> ޗ̏ԂŃXgɓ邱
+	@brief@	| Ď钙ɂݒ
+	@param		| pStorageHouseFĎ钙ɁAnullptrŉ
 *//*****************************************/
-std::list<CItem::ITEM_TYPE> CFoodFactory::GetProducibleMealTypes()
+void CFoodFactory::WatchStorageHouse(CStorageHouse* pStorageHouse)
 {
-	// \ȗ̃ACe^CvXg
-	std::list<CItem::ITEM_TYPE> vCanCookItems;
+	if (pStorageHouse == m_pStorageHouse) return;
+
+	// ȑO̒ɂ̊Ď
+	if (m_pStorageHouse != nullptr) m_pStorageHouse->RemoveStorageObserver(*this);
 
-	// p
-	vCanCookItems.push_back(CItem::ITEM_TYPE::Bread);
+	m_pStorageHouse = pStorageHouse;
+	m_aMealReady.fill(false);
+	m_bPlanDirty = false;
 
-	// AbvpC
-	vCanCookItems.push_back(CItem::ITEM_TYPE::ApplePie);
+	if (m_pStorageHouse == nullptr) return;
 
-	// 
-	vCanCookItems.push_back(CItem::ITEM_TYPE::Sugar);
+	// VɂĎȀ݂[Ԃx]
+	m_pStorageHouse->AddStorageObserver(*this);
+	for (int i = 0; i < PRODUCIBLE_MEAL_NUM; ++i)
+	{
+		m_aMealReady[i] = IsMealReady(i);
+		if (m_aMealReady[i]) m_bPlanDirty = true;
+	}
+}
 
-	// \ȗ̃ACe^CvXgԂ
-	return vCanCookItems;
+/*****************************************//*
+	@brief@	| ̍ޗɂɑĂ邩ǂ𔻒
+	@param		| nMealIndexFPRODUCIBLE_MEAL_TYPES̃CfbNX
+	@return		| true:Ă false:sĂ
+*//*****************************************/
+bool CFoodFactory::IsMealReady(const int nMealIndex) const
+{
+	if (m_pStorageHouse == nullptr) return false;
+
+	// Kvɓ͂Ă邩𔻒
+	return m_pStorageHouse->HasMaterials(m_aMealMaterials[nMealIndex]);
+}
+
+/*****************************************//*
+	@brief@	| ̍ޗɎw肵ACe^Cv܂܂邩ǂ
+	@param		| nMealIndexFPRODUCIBLE_MEAL_TYPES̃CfbNX
+	@param		| eTypeFACe^Cv
+	@return		| true:܂܂ false:܂܂Ȃ
+*//*****************************************/
+bool CFoodFactory::UsesIngredient(const int nMealIndex, const CItem::ITEM_TYPE eType) const
+{
+	for (const CItem::Material& material : m_aMealMaterials[nMealIndex])
+	{
+		if (material.eItemType == eType) return true;
+	}
+	return false;
 }
@@ -7,13 +7,32 @@
 #pragma once
 #include "BuildObject.h"
 #include "Item.h"
+#include "StorageObserver.h"
+#include <array>
 #include <list>
+#include <vector>
 #include "Enums.h"
 
+// O錾
+class CStorageHouse;
+
 // @brief Lb`zNX
-class CFoodFactory final: public CBuildObject
+// @note ɂ̎[̕ωĎAޗ̂ݒv𗧂Ē
+class CFoodFactory final: public CBuildObject, public IStorageObserver
 {
 private:
+	// @brief \ȗ̎ސ
+	static constexpr int PRODUCIBLE_MEAL_NUM = 3;
+
+	// @brief \ȗ̃ACe^Cv
+	// @note z̏ = DIɍ闿̏
+	//       Ȃǂ̓ǉ闿Ȃǂɒǉ
+	static constexpr CItem::ITEM_TYPE PRODUCIBLE_MEAL_TYPES[PRODUCIBLE_MEAL_NUM] = {
+		CItem::ITEM_TYPE::Bread,
+		CItem::ITEM_TYPE::ApplePie,
+		CItem::ITEM_TYPE::Sugar
+	};
+
 	// @brief xɒłő˗
 	static constexpr int MAX_COOK_REQUESTS[MAX_BUILD_LEVEL] = {
 		1, 2, 3, 4, 5
@@ -58,6 +77,21 @@ public:
 	// @brief CXyN^[\
 	virtual int Inspecter() override;
 
+	// @brief [̕ωʒm
+	// @param pStorageHouseFω
+	// @param eTypeFωACe^Cv
+	// @param nCountFω̎[
+	void OnStorageChanged(CStorageHouse* pStorageHouse, const CItem::ITEM_TYPE eType, const int nCount) override;
+
+	// @brief ɂ̔jʒm
+	// @param pStorageHouseFj钙
+	void OnStorageDestroyed(CStorageHouse* pStorageHouse) override;
+
+	// @brief ɂ̐ʒm
+	// @param pStorageHouseFꂽ
+	// @note Ď̒ɂꍇ̂݊ĎJn
+	void OnStorageHouseCreated(CStorageHouse* pStorageHouse);
+
 	// @brief ˗󂯂
 	// @return ˗\̂̃|C^AȂnullptr
 	CookRequest* TakeRequest();
@@ -93,11 +127,22 @@ private:
 
 	// @brief \ȗT
 	// @return ꍇ͗̃ACe^CvAȂꍇMAXԂ
-	CItem::ITEM_TYPE FindProducibleMealType();
+	// @note ޗ̏[Ԃ̓LbVς݂̂ߒɂ͎QƂȂ
+	CItem::ITEM_TYPE FindProducibleMealType() const;
 
-	// @brief \ȗXg̎擾
-	// @return \ȗ̃ACe^CvXg
-	std::list<CItem::ITEM_TYPE> GetProducibleMealTypes();
+	// @brief Ď钙ɂݒ
+	// @param pStorageHouseFĎ钙ɁAnullptrŉ
+	void WatchStorageHouse(CStorageHouse* pStorageHouse);
+
+	// @brief ̍ޗɂɑĂ邩ǂ𔻒
+	// @param nMealIndexFPRODUCIBLE_MEAL_TYPES̃CfbNX
+	// @return true:Ă false:sĂ
+	bool IsMealReady(const int nMealIndex) const;
+
+	// @brief ̍ޗɎw肵ACe^Cv܂܂邩ǂ
+	// @param nMealIndexFPRODUCIBLE_MEAL_TYPES̃CfbNX
+	// @param eTypeFACe^Cv
+	bool UsesIngredient(const int nMealIndex, const CItem::ITEM_TYPE eType) const;
 
 private:
 
@@ -107,5 +152,18 @@ private:
 	// @brief zol
 	float m_fBuildXP = 0.0f;
 
+	// @brief ĎĂ钙
+	CStorageHouse* m_pStorageHouse = nullptr;
+
+	// @brief Ƃ̍ޗXgiɈx擾j
+	std::array<CItem::MaterialSpan, PRODUCIBLE_MEAL_NUM> m_aMealMaterials;
+
+	// @brief Ƃ̍ޗ[
+	std::array<bool, PRODUCIBLE_MEAL_NUM> m_aMealReady{};
+
+	// @brief v̍ĕ]Kvǂ
+	// @note ޗs[ɕω̂trueɂ
+	bool m_bPlanDirty = false;
+
 };
 
@@ -7,6 +7,7 @@
 #include "Oparation.h"
 #include "ImguiSystem.h"
 #include "StructMath.h"
+#include "SteeringMath.h"
 
 #undef max
 
@@ -328,26 +329,19 @@ float CGameObject::GetBoundingRadius() const
 bool CGameObject::MoveToTarget(CGameObject* In_pTargetObj, float In_fMoveSpeed)
 {
 	// ターゲットオブジェクトの位置を取得
-	DirectX::XMFLOAT3 targetPos = In_pTargetObj->m_tParam.m_f3Pos;
+	const DirectX::XMVECTOR targetPos = SteeringMath::Load(In_pTargetObj->m_tParam.m_f3Pos);
 	// 自身の位置を取得
-	DirectX::XMFLOAT3 myPos = m_tParam.m_f3Pos;
+	const DirectX::XMVECTOR myPos = SteeringMath::Load(m_tParam.m_f3Pos);
 
-	// ターゲットまでの距離を計算
-	float distance = StructMath::Distance(myPos, targetPos);
+	// ターゲットに向かうベクトルと距離を計算
+	const DirectX::XMVECTOR toTarget = DirectX::XMVectorSubtract(targetPos, myPos);
+	const float distance = SteeringMath::Length(toTarget);
 
 	// 一定距離以内に到達した場合
     if (distance < 1.0f)return true;
 
-	// ターゲットに向かう方向ベクトルを計算
-	DirectX::XMFLOAT3 direction = targetPos - myPos;
-	// 正規化
-	direction = StructMath::Normalize(direction);
-
-	// 移動処理
-	myPos += direction * In_fMoveSpeed;
-
-	// 位置の更新
-	m_tParam.m_f3Pos = myPos;
+	// 正規化した方向に移動し、位置を更新
+	m_tParam.m_f3Pos = SteeringMath::Store(DirectX::XMVectorAdd(myPos, DirectX::XMVectorScale(toTarget, In_fMoveSpeed / distance)));
 
     return false;
 }
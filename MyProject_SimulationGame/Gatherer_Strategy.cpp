@@ -16,6 +16,7 @@
 #include "CivLevelManager.h"
 #include "BlackSmith.h"
 #include "BuildManager.h"
+#include "TaskBoardManager.h"
 
 /****************************************//*
 	@brief@	|@d
@@ -60,15 +61,30 @@ void CGatherer_Strategy::OnChangeJob()
 	// WIIuWFNg̃^[QeBOID
 	if (m_pTarget != nullptr)
 	{
-		m_pTarget->SetTargetingID(ObjectID{ "", -1 });
+		m_pTarget->ReleaseClaim();
 		m_pTarget = nullptr;
 	}
 
+	// Ɗ蓖Ă̈˗
+	CTaskBoardManager::GetInstance()->CancelRequest(this);
+
 	// dԂ
 	m_eCurrentState = WorkState::SearchAndMove;
 	m_ePrevState = WorkState::SearchAndMove;
 }
 
+/****************************************//*
+	@brief@	|@d̒f
+	@note		|	xeEHɕWI蓖ĂȂ悤Ɉ˗
+*//****************************************/
+void CGatherer_Strategy::OnStopWork()
+{
+	// NX̎d̒f
+	IJob_Strategy::OnStopWork();
+
+	CTaskBoardManager::GetInstance()->CancelRequest(this);
+}
+
 /****************************************//*
 	@brief@	|@CXyN^[\
 	@param@	|	isEndFtrue:ImGuiEnd()Ă false:Ă΂Ȃ
@@ -142,6 +158,23 @@ void CGatherer_Strategy::DrawJobStatusImGui()
 	}
 }
 
+/****************************************//*
+	@brief@	|@Ɗ蓖ĊǗVXeWI蓖Ă
+	@param		|	pTargetF蓖Ă̎ΏۃIuWFNg
+	@return		|	true:\񂵂ĕWIɐݒ肵 false:ɕWIE\ς
+*//****************************************/
+bool CGatherer_Strategy::AssignTarget(CCollectTarget* pTarget)
+{
+	// ɕWIꍇ͊蓖ĂȂ
+	if (m_pTarget != nullptr || pTarget == nullptr) return false;
+
+	// \łꍇ̂ݕWIɐݒ
+	if (!pTarget->TryClaim(m_pOwner->GetID())) return false;
+
+	m_pTarget = pTarget;
+	return true;
+}
+
 /****************************************//*
 	@brief@	|@Tړ̏
 *//****************************************/
@@ -197,32 +230,9 @@ void CGatherer_Strategy::SearchAndMoveAction()
 	// WIɂĂIuWFNgȂꍇ
 	if (m_pTarget == nullptr)
 	{
-		std::vector<ObjectID> vNotTargetIDs;
-
-		// WIIuWFNgT[v
-		// ^[QeBOIDݒ肳ĂIuWFNg͔ĒT
-		while (1)
-		{
-			// IuWFNgT
-			m_pTarget = SearchTarget(vNotTargetIDs);
-
-			// ؃IuWFNgȂꍇ̓[v𔲂
-			if (m_pTarget == nullptr)return;
-
-			// WIIuWFNgɐݒ肳Ă^[QeBOID擾
-			ObjectID targetingID = m_pTarget->GetTargetingID();
-
-			// ^[QeBOIDݒ肳Ă邩mF
-			if (targetingID.m_nSameCount != -1)
-			{
-				// ^[QeBOIDݒ肳Ăꍇ́AIDXgɒǉ
-				vNotTargetIDs.push_back(m_pTarget->GetID());
-			}
-			// ^[QeBOIDݒ肳ĂȂꍇ̓[v𔲂
-			else break;
-		}
-		// gIDWIIuWFNgɐݒ
-		m_pTarget->SetTargetingID(m_pOwner->GetID());
+		// Ɗ蓖ĊǗVXeɕWI̊蓖Ă˗đҋ@
+		// ʂɒTAԊuł܂Ƃ߂Ċ蓖Ă
+		CTaskBoardManager::GetInstance()->RequestTask(this);
 	}
 	else
 	{
@@ -349,7 +359,7 @@ void CGatherer_Strategy::StoringAction()
 		if (m_pOwner->MoveToTarget(pStorageHouse, Human_Move_Speed))
 		{
 			// ɂɃACe[
-			dynamic_cast<CStorageHouse*>(pStorageHouse)->StoreItem(m_pOwner->TakeOutItem());
+			pStorageHouse->StoreItem(m_pOwner->GetInventory().TakeAny());
 			return;
 		}
 	}
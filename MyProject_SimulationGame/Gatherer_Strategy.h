@@ -34,6 +34,9 @@ public:
 	// @brief ؂ւ
 	virtual void OnChangeJob() override;
 
+	// @brief d̒f
+	virtual void OnStopWork() override;
+
 	// @brief CXyN^[\
 	// @param isEndFtrue:ImGuiEnd()Ă false:Ă΂Ȃ
 	// @return \ڐ
@@ -42,6 +45,23 @@ public:
 	// @brief EƃXe[^XImGui`揈
 	virtual void DrawJobStatusImGui() override;
 
+	// @brief Ɗ蓖ĊǗVXeWI蓖Ă
+	// @param pTargetF蓖Ă̎ΏۃIuWFNg
+	// @return true:\񂵂ĕWIɐݒ肵 false:ɕWIE\ς
+	bool AssignTarget(CCollectTarget* pTarget);
+
+	// @brief WǏT
+	// @param nMaxCountF擾ő吔
+	// @return \ŋ߂ɕ񂾍̎ΏۃIuWFNg̃|C^Xg
+	virtual std::vector<CCollectTarget*> SearchTargets(const size_t nMaxCount) = 0;
+
+	// @brief Ɗ蓖Ă˗ǂ
+	bool IsTaskRequested() const { return m_isTaskRequested; }
+
+	// @brief Ɗ蓖Ă˗ǂ̐ݒ
+	// @note Ɗ蓖ĊǗVXeݒ肷
+	void SetTaskRequested(bool isRequested) { m_isTaskRequested = isRequested; }
+
 private:
 
 	// @brief Tړ
@@ -60,13 +80,6 @@ private:
 	void RestingAction();
 
 
-protected:
-
-	// @brief WIT
-	// @param vNotTargetIDsF^[QeBOIDݒ肳ĂIuWFNgIDXg
-	// @return ̎ΏۃIuWFNg̃|C^
-	virtual CCollectTarget* SearchTarget(std::vector<ObjectID> vNotTargetIDs) = 0;
-
 private:
 
 	// @brief ݂̎d
@@ -77,5 +90,8 @@ private:
 	// @brief WIɂĂ̎ΏۃIuWFNg̃|C^
 	CCollectTarget* m_pTarget = nullptr;
 
+	// @brief Ɗ蓖Ă˗ǂ
+	bool m_isTaskRequested = false;
+
 };
 
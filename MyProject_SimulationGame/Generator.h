@@ -8,6 +8,9 @@
 #pragma once
 #include "Observer.h"
 #include "FieldManager.h"
+#include <cstdint>
+#include <deque>
+#include <string>
 
 // @brief WFl[^[C^[tF[X
 class IGenerator : public IObserver
@@ -19,6 +22,12 @@ public:
 	// @brief ʒm
 	void Notify() override { Generate(); }
 
+	// @brief t[̍XV
+	// @param nCurrentTickF݂̃t[
+	// @param nBudgetF̃t[ɐĂ悢IuWFNg
+	// @return IuWFNg
+	virtual int Update(uint64_t nCurrentTick, int nBudget) { return 0; }
+
 protected:
 
 	// @brief 
@@ -26,6 +35,68 @@ protected:
 
 };
 
+// @brief ĐWFl[^[NX
+// @note ͊ZĐt[ƋɋL^AĐt[}̂
+//       t[Ƃ̐܂ŏ
+class CRegrowthGenerator : public IGenerator
+{
+public:
+	// @brief RXgN^
+	// @param eCellTypeFĐZ^Cv
+	// @param fRegrowTimeF͊ĂĐ܂ł̎ԁibj
+	// @param sResourceNameFifobOOpj
+	CRegrowthGenerator(CFieldCell::CellType eCellType, float fRegrowTime, const std::string& sResourceName);
+
+	// @brief t[̍XV
+	// @param nCurrentTickF݂̃t[
+	// @param nBudgetF̃t[ɐĂ悢IuWFNg
+	// @return IuWFNg
+	int Update(uint64_t nCurrentTick, int nBudget) override;
+
+	// @brief Đ҂̃Z擾
+	size_t GetRegrowWaitingCount() const { return m_RegrowQueue.size(); }
+
+protected:
+	// @brief 
+	// @note ̓tB[h쐬̂ߑɑSĐA
+	//       ȍ~͍Đ҂̃ZSčĐ\ɂiUpdateŕUj
+	void Generate() override;
+
+	// @brief IuWFNg̐
+	// @param pCellF̃Z
+	virtual void SpawnResource(CFieldCell* pCell) = 0;
+
+private:
+	// @brief VɌ͊ZĐ҂ɒǉ
+	void CollectDepletedCells();
+
+private:
+	// @brief Đ҂Z\
+	struct RegrowEntry
+	{
+		CFieldCell* pCell;		// ĐZ
+		uint64_t nRegrowTick;	// Đt[
+	};
+
+	// @brief Đ҂Z̃L[i҂Ԃ̂ߍĐt[ɕԁj
+	std::deque<RegrowEntry> m_RegrowQueue;
+
+	// @brief ĐZ^Cv
+	CFieldCell::CellType m_eCellType;
+
+	// @brief ͊ĂĐ܂ł̃t[
+	uint64_t m_nRegrowWaitTick;
+
+	// @brief ŌɍXVt[
+	uint64_t m_nCurrentTick;
+
+	// @brief 񐶐sǂ
+	bool m_bInitialized;
+
+	// @brief ifobOOpj
+	std::string m_sResourceName;
+};
+
 // hNX̃wb_[t@C̃CN[h
 #include "HumanGenerator.h"
 #include "WoodGenerator.h"
@@ -6,46 +6,55 @@
 *//**************************************************/
 #include "GeneratorManager.h"
 #include "Main.h"
+#include <algorithm>
+#include <cmath>
+
+/*****************************************
+	@brief@	| fXgN^
+*//*****************************************/
+CGeneratorManager::~CGeneratorManager()
+{
+	// WFl[^[̉
+	for (IGenerator*& pGenerator : m_pGenerators)
+	{
+		SAFE_DELETE(pGenerator);
+	}
+}
 
 /*****************************************
 	@brief@	| XV
+	@note@@	| t[ɒBNGXgq[v̐擪o
+				| ɒBꍇAc͎̃t[ɉ
 *//*****************************************/
 void CGeneratorManager::Update()
 {
-	// NGXgXgȂꍇ͏𔲂
-	if (m_GenerateRequestList.empty())return;
+	// t[i߂
+	++m_nCurrentTick;
+
+	// ̃t[ɐĂ悢c萔
+	int nBudget = m_nMaxGeneratePerFrame;
+
+	// t[ɒBNGXg܂ŏ
+	while (nBudget > 0 && !m_GenerateRequestHeap.empty() && m_GenerateRequestHeap.front().m_nDueTick <= m_nCurrentTick)
+	{
+		// 擪̃NGXgo
+		std::pop_heap(m_GenerateRequestHeap.begin(), m_GenerateRequestHeap.end(), IsLaterRequest);
+		GenerateType eType = m_GenerateRequestHeap.back().m_GenerateType;
+		m_GenerateRequestHeap.pop_back();
 
-	// NGXgXg̐擪珈s
-	for (int i = 0; i < static_cast<int>(m_GenerateRequestList.size()); ++i)
+		// ^CvɉIuU[o[ւ̒ʒm
+		NotifyGenerate(eType);
+		nBudget--;
+	}
+
+	// c̐ŎĐ
+	const int nGeneratorNum = static_cast<int>(GenerateType::MAX);
+	for (int i = 0; i < nGeneratorNum && nBudget > 0; ++i)
 	{
-		// Ce[^擾
-		auto it = std::next(m_GenerateRequestList.begin(), i);
-		// oߎԂZ
-		it->m_fGenerateTime -= 1.0f / fFPS;
-
-		// ԂɒBꍇ͐s
-		if (it->m_fGenerateTime <= 0.0f)
-		{
-			// ^CvɉIuU[o[ւ̒ʒm
-			switch (it->m_GenerateType)
-			{
-			case GenerateType::Wood:
-				NotifyObserver<CWoodGenerator>();
-				break;
-			case GenerateType::Stone:
-				NotifyObserver<CStoneGenerator>();
-				break;
-			case GenerateType::Human:
-				NotifyObserver<CHumanGenerator>();
-				break;
-			}
-
-			// NGXgXg폜
-			it = m_GenerateRequestList.erase(it);
-			// Ce[^1Oɖ߂
-			--i;
-		}
+		IGenerator* pGenerator = m_pGenerators[(m_nRegrowStartIndex + i) % nGeneratorNum];
+		if (pGenerator) nBudget -= pGenerator->Update(m_nCurrentTick, nBudget);
 	}
+	m_nRegrowStartIndex = (m_nRegrowStartIndex + 1) % nGeneratorNum;
 }
 
 /*****************************************
@@ -53,39 +62,85 @@ void CGeneratorManager::Update()
 *//*****************************************/
 void CGeneratorManager::NotifyObservers()
 {
+	// ^CvɑSWFl[^[֒ʒm
+	for (int i = 0; i < static_cast<int>(GenerateType::MAX); ++i)
+	{
+		NotifyGenerate(static_cast<GenerateType>(i));
+	}
+
+	// ʂɓo^ꂽIuU[o[֒ʒm
 	for (IObserver* observer : m_Observers)
 	{
 		observer->Notify();
 	}
 }
 
+/*****************************************
+	@brief@	| ^CvƂ̃WFl[^[̐ݒ
+	@param@	| eTypeF^Cv
+	@param@	| pGeneratorFݒ肷WFl[^[iL͐ǗVXeɈڂj
+*//*****************************************/
+void CGeneratorManager::SetGenerator(GenerateType eType, IGenerator* pGenerator)
+{
+	if (eType == GenerateType::MAX) return;
+
+	// ɐݒ肳Ăꍇ͉čւ
+	SAFE_DELETE(m_pGenerators[static_cast<int>(eType)]);
+	m_pGenerators[static_cast<int>(eType)] = pGenerator;
+}
+
 /*****************************************
 	@brief@	| NGXg̒ǉ
 	@param@	| request NGXg
 *//*****************************************/
 void CGeneratorManager::AddGenerateRequest(GenerateRequest request)
 {
-	// NGXgXgɒǉ
-	m_GenerateRequestList.push_back(request);
+	// ҂Ԃt[ɕϊit[1/FPS炵ĂƓt[Őj
+	uint64_t nWaitTick = 0;
+	if (request.m_fGenerateTime > 0.0f)
+	{
+		nWaitTick = static_cast<uint64_t>(std::ceil(request.m_fGenerateTime * fFPS - 0.001f));
+	}
+
+	// NGXgq[vɒǉ
+	m_GenerateRequestHeap.push_back({ request.m_GenerateType, m_nCurrentTick + nWaitTick, m_nNextSequence++ });
+	std::push_heap(m_GenerateRequestHeap.begin(), m_GenerateRequestHeap.end(), IsLaterRequest);
 }
 
 /*****************************************
-	@brief@	| IuU[o[̒ʒm
+	@brief@	| ܂ł̎c莞Ԃ擾
+	@param@	| requestF\ςݐNGXg
+	@return@	| c莞ԁibj
 *//*****************************************/
-template<typename T>
-void CGeneratorManager::NotifyObserver()
+float CGeneratorManager::GetRemainingTime(const ScheduledRequest& request) const
 {
-	// o^ĂSIuU[o[ɑ΂Ēʒms
-	for (IObserver* observer : m_Observers)
-	{
-		// _ELXg݂
-		T* specificObserver = dynamic_cast<T*>(observer);
-
-		// _ELXgɐꍇ̂ݒʒms
-		if (specificObserver)
-		{
-			// ʒmĂяo
-			specificObserver->Notify();
-		}
-	}
-}
\ No newline at end of file
+	if (request.m_nDueTick <= m_nCurrentTick) return 0.0f;
+
+	return static_cast<float>(request.m_nDueTick - m_nCurrentTick) / fFPS;
+}
+
+/*****************************************
+	@brief@	| ^CvɉIuU[o[ւ̒ʒm
+	@param@	| eTypeF^Cv
+*//*****************************************/
+void CGeneratorManager::NotifyGenerate(GenerateType eType)
+{
+	if (eType == GenerateType::MAX) return;
+
+	// ^CvɑΉWFl[^[֒ڒʒm
+	IGenerator* pGenerator = m_pGenerators[static_cast<int>(eType)];
+	if (pGenerator) pGenerator->Notify();
+}
+
+/*****************************************
+	@brief@	| q[v̔r
+	@param@	| aFr郊NGXg
+	@param@	| bFr郊NGXg
+	@return@	| true:a̕ɐ
+	@note@@	| std::push_heap͍őq[v̂߁Atɂčŏq[vƂĈ
+*//*****************************************/
+bool CGeneratorManager::IsLaterRequest(const ScheduledRequest& a, const ScheduledRequest& b)
+{
+	if (a.m_nDueTick != b.m_nDueTick) return a.m_nDueTick > b.m_nDueTick;
+	return a.m_nSequence > b.m_nSequence;
+}
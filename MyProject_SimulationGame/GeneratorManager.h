@@ -8,10 +8,15 @@
 #include "Singleton.h"
 #include "SubJect.h"
 #include "Generator.h"
+#include <vector>
+#include <cstdint>
 
 // @brief lԂ̍Đ҂ԁibj
 const float Human_Regenerate_Wait_Time = 5.0f;
 
+// @brief 1t[ɐIuWFNg̊̏
+const int Default_Max_Generate_Per_Frame = 8;
+
 // @brief ǗVXeNX
 class CGeneratorManager final : public ISubJect, public ISingleton<CGeneratorManager>
 {
@@ -21,7 +26,10 @@ public:
 	{
 		Wood,	// ؍ސ
 		Stone,	// ΍ސ
+		Grass,	// 
 		Human,	// lԐ
+		Animal,	// 
+		MAX,	// ^Cv̍ő吔
 	};
 
 	// @brief NGXg\
@@ -34,6 +42,20 @@ public:
 		float m_fGenerateTime;
 	};
 
+	// @brief \ςݐNGXg\
+	// @note ΃t[Ŏ߁Aҋ@̃NGXg𖈃t[XVKvȂ
+	struct ScheduledRequest
+	{
+		// @brief ^Cv
+		GenerateType m_GenerateType;
+
+		// @brief t[
+		uint64_t m_nDueTick;
+
+		// @brief ǉit[ɐꍇ͒ǉɏj
+		uint64_t m_nSequence;
+	};
+
 private:
 	// @brief RXgN^
 	CGeneratorManager() = default;
@@ -41,31 +63,69 @@ private:
 	friend class ISingleton<CGeneratorManager>;
 public:
 	// @brief fXgN^
-	~CGeneratorManager() override = default;
+	~CGeneratorManager() override;
 
 	// @brief XV
 	void Update();
 
 	// @brief SIuU[o[ւ̒ʒm
+	// @note S^CṽWFl[^[𐶐^Cvɒʒm
 	void NotifyObservers() override;
 
-	// @brief wIuU[o[̒ʒm
-	// @tparam T ʒmΏۂ̃IuU[o[NX^
-	template<typename T = IGenerator>
-	void NotifyObserver();
+	// @brief ^CvƂ̃WFl[^[̐ݒ
+	// @param eTypeF^Cv
+	// @param pGeneratorFݒ肷WFl[^[iL͐ǗVXeɈڂj
+	void SetGenerator(GenerateType eType, IGenerator* pGenerator);
 
 	// @brief NGXg̒ǉ
 	// @param requestFǉ鐶NGXg
+	// @note O(log n)ŗ\񂷂
 	void AddGenerateRequest(GenerateRequest request);
 
 	// @brief NGXgXg̎擾
-	// @return NGXgXg̎Q
-	std::list<GenerateRequest>& GetGenerateRequestList() { return m_GenerateRequestList; }
+	// @return NGXg̃q[viɂ͕łȂj
+	const std::vector<ScheduledRequest>& GetGenerateRequestList() const { return m_GenerateRequestHeap; }
+
+	// @brief 1t[ɐIuWFNg̏ݒ
+	// @param nMaxFi1ȏj
+	void SetMaxGeneratePerFrame(int nMax) { m_nMaxGeneratePerFrame = (nMax < 1) ? 1 : nMax; }
+
+	// @brief 1t[ɐIuWFNg̏擾
+	int GetMaxGeneratePerFrame() const { return m_nMaxGeneratePerFrame; }
+
+	// @brief ܂ł̎c莞Ԃ擾
+	// @param requestF\ςݐNGXg
+	// @return c莞ԁibj
+	float GetRemainingTime(const ScheduledRequest& request) const;
 
 private:
 
-	// @brief NGXgXg
-	std::list<GenerateRequest> m_GenerateRequestList;
+	// @brief ^CvɉIuU[o[ւ̒ʒm
+	// @param eTypeF^Cv
+	void NotifyGenerate(GenerateType eType);
+
+	// @brief q[v̔rit[̂擪ɂj
+	static bool IsLaterRequest(const ScheduledRequest& a, const ScheduledRequest& b);
+
+private:
+
+	// @brief ^CvƂ̃WFl[^[iʒmOɉĂj
+	IGenerator* m_pGenerators[static_cast<int>(GenerateType::MAX)] = {};
+
+	// @brief NGXg̍ŏq[vit[j
+	std::vector<ScheduledRequest> m_GenerateRequestHeap;
+
+	// @brief ݂̃t[
+	uint64_t m_nCurrentTick = 0;
+
+	// @brief Ɋ蓖Ăǉ
+	uint64_t m_nNextSequence = 0;
+
+	// @brief 1t[ɐIuWFNg̏
+	int m_nMaxGeneratePerFrame = Default_Max_Generate_Per_Frame;
+
+	// @brief ĐŏɍsWFl[^[it[炵ĕ΂hj
+	int m_nRegrowStartIndex = 0;
 };
 
 // Generator̃CN[h
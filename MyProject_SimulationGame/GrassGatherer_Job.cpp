@@ -18,14 +18,16 @@ CGrassGatherer_Job::CGrassGatherer_Job()
 }
 
 /******************************************//*
-	@brief@	| WIT
-	@return		| ̎ΏۃIuWFNg̃|C^
+	@brief@	| WǏT
+	@param		| nMaxCountF擾ő吔
+	@return		| \ŋ߂ɕ񂾍̎ΏۃIuWFNg̃|C^Xg
 	@note		| IuWFNgT
 *//******************************************/
-CCollectTarget* CGrassGatherer_Job::SearchTarget(std::vector<ObjectID> vNotTargetIDs)
+std::vector<CCollectTarget*> CGrassGatherer_Job::SearchTargets(const size_t nMaxCount)
 {
 	// IuWFNgT
-	return GetScene()->GetGameObject<CGrass>(m_pOwner->GetPos(), vNotTargetIDs);
+	std::vector<CGrass*> targets = CCollectTarget::FindUnclaimedCandidates<CGrass>(m_pOwner->GetPos(), nMaxCount);
+	return std::vector<CCollectTarget*>(targets.begin(), targets.end());
 }
 
 /******************************************//*
@@ -32,11 +32,10 @@ public:
 	// @return iCt̃ACe^Cv
 	CItem::ITEM_TYPE GetRequiredCollectToolType() const override { return CItem::ITEM_TYPE::Sickle; }
 
-private:
-
-	// @brief WIT
-	// @return ̎ΏۃIuWFNg̃|C^
-	CCollectTarget* SearchTarget(std::vector<ObjectID> vNotTargetIDs) override;
+	// @brief WǏT
+	// @param nMaxCountF擾ő吔
+	// @return \ŋ߂ɕ񂾍̎ΏۃIuWFNg̃|C^Xg
+	std::vector<CCollectTarget*> SearchTargets(const size_t nMaxCount) override;
 
 };
 
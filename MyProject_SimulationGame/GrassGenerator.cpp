@@ -2,35 +2,28 @@
 	@file	| GrassGenerator.cpp
 	@brief	| WFl[^[NXcppt@C
 	@note	| 𐶐WFl[^[
-			| IGeneratorp
+			| CRegrowthGeneratorp
 *//**************************************************/
 #include "GrassGenerator.h"
 #include "Grass.h"
 #include "Main.h"
-#include "ImguiSystem.h"
 
 #undef min
 
 /*****************************************
-	@brief@	| 
+	@brief@	| RXgN^
 *//*****************************************/
-void CGrassGenerator::Generate()
+CGrassGenerator::CGrassGenerator()
+	: CRegrowthGenerator(CFieldCell::CellType::GRASS, REGROW_TIME, u8"")
 {
-	// zu\ȖgpZ擾
-	auto cells = CFieldManager::GetInstance()->GetFieldGrid()->GetFieldCells(CFieldCell::CellType::GRASS, false);
-
-	// zu\ȃZȂΏI
-	if (cells.empty()) return;
-
-	// ̍ő吶
-	int createNum = 0;
-	for(auto cell : cells)
-	{
-		// IuWFNg𐶐AIoZɔzu
-		GetScene()->AddGameObject<CGrass>(Tag::GameObject, u8"")->SetCreatePos(cell);
-		createNum++;
-	}
+}
 
-	// fobOO̒ǉ
-	CImguiSystem::GetInstance()->AddDebugLog(std::string(u8"") + std::to_string(createNum) + std::string(u8"܂"), false);
+/*****************************************
+	@brief@	| IuWFNg̐
+	@param@	| pCellF̃Z
+*//*****************************************/
+void CGrassGenerator::SpawnResource(CFieldCell* pCell)
+{
+	// IuWFNg𐶐AZɔzu
+	GetScene()->AddGameObject<CGrass>(Tag::GameObject, u8"")->SetCreatePos(pCell);
 }
@@ -2,16 +2,23 @@
 	@file	| GrassGenerator.h
 	@brief	| WFl[^[NXht@C
 	@note	| 𐶐WFl[^[
-			| IGeneratorp
+			| CRegrowthGeneratorp
 *//**************************************************/
 #pragma once
 #include "Generator.h"
 
 // @brief WFl[^[NX
-class CGrassGenerator : public IGenerator
+class CGrassGenerator : public CRegrowthGenerator
 {
+public:
+	// @brief ͊ĂĐ܂ł̎ԁibj
+	static constexpr float REGROW_TIME = 30.0f;
+
+	// @brief RXgN^
+	CGrassGenerator();
+
 private:
-	// @brief 
-	void Generate() override;
+	// @brief IuWFNg̐
+	// @param pCellF̃Z
+	void SpawnResource(CFieldCell* pCell) override;
 };
-
@@ -6,6 +6,7 @@
 #pragma once
 #include "AnimalAI.h"
 #include "Oparation.h"
+#include "SteeringMath.h"
 
 // @brief QAINX
 class CGroupAI : public CAnimalAI
@@ -28,21 +29,16 @@ public:
 		// BoidsXeAOvZĂяo
 		return BoidsSteering::Compute(pos, vel, neighbors, m_BoidsParams);
 	}
-protected:
 
-	// @brief xNg̒𐧌
-	// @param vFxNg
-	// @param maxLenFő咷
-	// @return xNg
-	static DirectX::XMFLOAT3 Limit(const DirectX::XMFLOAT3& v, float maxLen)
-	{
-		float len = StructMath::Length(v);
-		if (len > maxLen && len > 0.0001f) return v * (maxLen / len);
-		return v;
-	}
+	// @brief Q̐ݒ
+	// @param pFlockFQ
+	void SetFlock(const CFlock* pFlock) override { m_pFlock = pFlock; }
 
 protected:
 	// @brief Boidsp[^
 	BoidsParams m_BoidsParams;
+
+	// @brief QiQ̒S⏄_͂ǂށj
+	const CFlock* m_pFlock = nullptr;
 };
 
@@ -18,6 +18,7 @@
 #include "Main.h"
 #include "Item.h"
 #include "StorageHouse.h"
+#include "DecisionScheduler.h"
 
 /****************************************//*
 	@brief@	| RXgN^
@@ -30,6 +31,7 @@ CHuman::CHuman()
 	, m_eState(HUMAN_STATE::Working)
 	, m_pToolItem(nullptr)
 	, m_isReturnToolToStorage(false)
+	, m_isDecisionRequested(false)
 {
 	// f_[R|[lg̒ǉ
 	AddComponent<CModelRenderer>();
@@ -38,9 +40,6 @@ CHuman::CHuman()
 	m_pStaminaGaugeBillboard = new CBillboardRenderer(this);
 	m_pStaminaGaugeBillboard->SetKey("Bar_Gauge");
 
-	// ̗͏
-	m_fHealth = Max_Health;
-
 	// XL̒ǉ
 	m_pSkill = std::make_unique<CSkill>();
 
@@ -48,12 +47,21 @@ CHuman::CHuman()
 	m_pJob->SetOwner(*this);
 
 	// X^~ĩXL{[iXKp
-	m_pSkill->ApplySkillBuff(m_fMaxStamina, CSkill::SkillTarget::MaxStamina);
-	m_fStamina = m_fMaxStamina;
+	float fMaxStamina = Job_Max_Stamina;
+	m_pSkill->ApplySkillBuff(fMaxStamina, CSkill::SkillTarget::MaxStamina);
+	SetMaxStamina(fMaxStamina);
 
 	// ̗͂̃XL{[iXKp
-	m_pSkill->ApplySkillBuff(m_fMaxHealth, CSkill::SkillTarget::MaxHealth);
-	m_fHealth = m_fMaxHealth;
+	float fMaxHealth = Max_Health;
+	m_pSkill->ApplySkillBuff(fMaxHealth, CSkill::SkillTarget::MaxHealth);
+	SetMaxHealth(fMaxHealth);
+
+	// 󕠓x0ɂȂƉ쎀
+	SetStarvable(true);
+	SetHungerDecrease(Natural_Hunger_Decrease);
+
+	// ԌXPW[[ɓo^
+	CDecisionScheduler::GetInstance()->Register(this);
 }
 
 /****************************************//*
@@ -61,15 +69,14 @@ CHuman::CHuman()
 *//****************************************/
 CHuman::~CHuman()
 {
+	// ԌXPW[[o^
+	CDecisionScheduler::GetInstance()->Unregister(this);
+
 	// X^~iQ[Wr{[h̉
 	SAFE_DELETE(m_pStaminaGaugeBillboard);
 
-	// ACẻ
-	for (CItem* pItem : m_ItemList)
-	{
-		delete pItem;
-	}
-	m_ItemList.clear();
+	// ACe̔j
+	m_Inventory.Clear();
 
 	// EƃXgeW[̉
 	m_pJob.reset();
@@ -146,14 +153,22 @@ void CHuman::Update()
 		GoEatFood();
 		break;
 	}
+}
 
+/****************************************//*
+	@brief@	| Ԃ̌菈
+	@note		| ԌXPW[[琔t[ɈxA
+				| ܂̓CxgŗvꂽɌĂ΂
+*//****************************************/
+void CHuman::DecideState()
+{
 	// ɂ̎擾
 	CStorageHouse* pStorageHouse = GetScene()->GetGameObject<CStorageHouse>();
 	// Hꍇ̏
 	if(HasFood() || pStorageHouse->HasFood())
 	{
 		// 󕠓xxlHԂɈڍs
-		if (m_fHunger < Warning_Hunger)
+		if (GetHunger() < Warning_Hunger)
 		{
 			m_eState = CHuman::HUMAN_STATE::Eating;
 			m_isEating = true;
@@ -195,23 +210,35 @@ void CHuman::Update()
 		}
 	}
 
-	// 󕠓x̌
-	// xełȂΓ{ŋ󕠓x
+	// dȊȌԂɈڂꍇ͐EƂɎd̒fʒm
+	if (m_eState != CHuman::HUMAN_STATE::Working && m_pJob) m_pJob->OnStopWork();
+
+	// 󕠓x̌ʂ̐ݒiƉ쎀̔͐lǗVXeł܂Ƃ߂čsj
+	// xełȂΓ{AxełΔ̑xŋ󕠓x
 	if (m_eState != CHuman::HUMAN_STATE::Resting)
 	{
-		m_fHunger -= Natural_Hunger_Decrease;
+		SetHungerDecrease(Natural_Hunger_Decrease);
 	}
-	// xełΔ̑xŋ󕠓x
 	else
 	{
-		m_fHunger -= Natural_Hunger_Decrease * 0.5f;
+		SetHungerDecrease(Natural_Hunger_Decrease * 0.5f);
 	}
-	// 󕠓x0玀S
-	if (m_fHunger < 0.0f)
+}
+
+/****************************************//*
+	@brief@	| lCxg̒ʒm
+	@param		| eEventFCxg̎
+*//****************************************/
+void CHuman::OnVitalsEvent(CVitalsManager::VitalsEvent eEvent)
+{
+	// 󕠂ɂȂHɌǂɌ肷
+	if (eEvent == CVitalsManager::VitalsEvent::WarningHunger)
 	{
-		// IuWFNgj
-		Destroy();
+		CDecisionScheduler::GetInstance()->RequestDecision(this);
 	}
+
+	// NX̐lCxg̒ʒm
+	CEntity::OnVitalsEvent(eEvent);
 }
 
 /****************************************//*
@@ -227,7 +254,7 @@ void CHuman::Draw()
 	}
 
 	// X^~iQ[W̕`
-	float fStaminaRatio = m_fStamina / m_fMaxStamina;
+	float fStaminaRatio = GetStamina() / GetMaxStamina();
 
 	// X^~i^łȂΕ`
 	if (fStaminaRatio < 1.0f)
@@ -266,6 +293,13 @@ void CHuman::OnDestroy()
 		m_pLivingHouse = nullptr;
 	}
 
+	// EƂ\񂵂ĂWΏۂxe{݂̘g
+	if (m_pJob)
+	{
+		m_pJob->OnStopWork();
+		m_pJob->OnChangeJob();
+	}
+
 	// NX̃IuWFNgj̏
 	CGameObject::OnDestroy();
 }
@@ -290,23 +324,23 @@ int CHuman::Inspecter(bool isEnd)
 	// eLXgJ[̐ݒ
 	// ʏ펞͗ΐFA̗͂20ȉ̏ꍇ͐ԐFɕύX
 	ImVec4 HealthTextColor = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
-	if(m_fHealth <= 20.0f)
+	if(GetHealth() <= 20.0f)
 	{
 		HealthTextColor = ImVec4(1.0f, 0.0f, 0.0f, 1.0f);
 	}
 
-	ImGui::TextColored(HealthTextColor, "Health: %.2f / %.2f", m_fHealth, Max_Health);
+	ImGui::TextColored(HealthTextColor, "Health: %.2f / %.2f", GetHealth(), Max_Health);
 
 	// 󕠓x\
 	// eLXgJ[̐ݒ
 	// ʏ펞͗ΐFA󕠓x20ȉ̏ꍇ͐ԐFɕύX
 	ImVec4 HumgerTextColor = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
-	if(m_fHunger <= 20.0f)
+	if(GetHunger() <= 20.0f)
 	{
 		HumgerTextColor = ImVec4(1.0f, 0.0f, 0.0f, 1.0f);
 	}
 
-	ImGui::TextColored(HumgerTextColor,"Humger: %.2f / %.2f", m_fHunger, Max_Hunger);
+	ImGui::TextColored(HumgerTextColor,"Humger: %.2f / %.2f", GetHunger(), Max_Hunger);
 
 	ImGui::Separator();
 
@@ -367,16 +401,14 @@ int CHuman::Inspecter(bool isEnd)
 		ImGui::BeginChild("ItemList", ImVec2(0, 150), true);
 		// ACeXg̕\
 		// Oƌ\
-		std::map<CItem::ITEM_TYPE, int> itemCountMap;
-		for (const CItem* pItem : m_ItemList)
-		{
-			itemCountMap[pItem->GetItemType()]++;
-		}
-		for (const auto& pair : itemCountMap)
+		for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
 		{
+			CItem::ITEM_TYPE eType = static_cast<CItem::ITEM_TYPE>(i);
+			if (m_Inventory.GetCount(eType) <= 0) continue;
+
 			// ACeƌ\
-			std::string itemName = CItem::ITEM_TYPE_TO_STRING(pair.first);
-			ImGui::Text((itemName + ": " + std::to_string(pair.second)).c_str());
+			std::string itemName = CItem::ITEM_TYPE_TO_STRING(eType);
+			ImGui::Text((itemName + ": " + std::to_string(m_Inventory.GetCount(eType))).c_str());
 		}
 
 		ImGui::EndChild();
@@ -401,85 +433,50 @@ int CHuman::Inspecter(bool isEnd)
 	return nItemCount;
 }
 
-/****************************************//*
-	@brief@	| ACe肾
-	@return		| oACe|C^AĂȂꍇnullptr
-*//****************************************/
-CItem* CHuman::TakeOutItem()
-{
-	// ACeXg̏ꍇnullptrԂ
-	if (m_ItemList.empty())return nullptr;
-
-	// ACeXg̐擪̃ACeo
-	CItem* pItem = m_ItemList.front();
-
-	// ACeXg폜
-	m_ItemList.erase(m_ItemList.begin());
-
-	// oACe|C^Ԃ
-	return pItem;
-}
-
 /****************************************//*
 	@brief@	| ACeo
 	@param		| itemTypeFoACe^Cv
-	@return		| oACe|C^AĂȂꍇnullptr
+	@return		| true:o false:ĂȂ
 *//****************************************/
-const CItem* CHuman::TakeOutItem(const CItem::ITEM_TYPE itemType)
+bool CHuman::TakeOutItem(const CItem::ITEM_TYPE itemType)
 {
-	// ACeXgT
-	for (auto it = m_ItemList.begin(); it != m_ItemList.end(); ++it)
-	{
-		// w肳ꂽACe^CvƈvACeT
-		if ((*it)->GetItemType() == itemType)
-		{
-			// ACeo
-			CItem* pItem = *it;
-			// ACeXg폜
-			m_ItemList.erase(it);
-			// oACe|C^Ԃ
-			return pItem;
-		}
-	}
-
-	// w肳ꂽACe^CṽACeĂȂꍇnullptrԂ
-	return nullptr;
+	return m_Inventory.Remove(itemType);
 }
 
 /****************************************//*
 	@brief@	| ACeo
 	@param		| itemCategoryFoACeJeS[
-	@return		| oACe|C^AĂȂꍇnullptr
+	@return		| oACe^CvAĂȂꍇITEM_TYPE::MAX
 *//****************************************/
-const CItem* CHuman::TakeOutItem(const CItem::ITEM_CATEGORY itemCategory)
+CItem::ITEM_TYPE CHuman::TakeOutItem(const CItem::ITEM_CATEGORY itemCategory)
 {
-	// ACeXgT
-	for (auto it = m_ItemList.begin(); it != m_ItemList.end(); ++it)
-	{
-		// w肳ꂽACeJeS[ƈvACeT
-		if ((*it)->GetItemCategory() == itemCategory)
-		{
-			// ACeo
-			CItem* pItem = *it;
-			// ACeXg폜
-			m_ItemList.erase(it);
-			// oACe|C^Ԃ
-			return pItem;
-		}
-	}
-
-	// w肳ꂽACeJeS[̃ACeĂȂꍇnullptrԂ
-	return nullptr;
+	return m_Inventory.TakeByCategory(itemCategory);
 }
 
 /****************************************//*
 	@brief@	| ACe
 	@param		| pItemFACe|C^
+	@note		| ƂċL^AACe|C^͉
 *//****************************************/
 void CHuman::HoldItem(CItem* pItem)
 {
-	// ACeXgɒǉ
-	m_ItemList.push_back(pItem);
+	if (pItem == nullptr)return;
+
+	// ɉZ
+	m_Inventory.Add(pItem->GetItemType());
+
+	// ŊǗ邽߃ACe{͉̂
+	delete pItem;
+}
+
+/****************************************//*
+	@brief@	| ACe܂Ƃ߂ď
+	@param		| itemTypeFACe^Cv
+	@param		| nAmountF
+*//****************************************/
+void CHuman::HoldItem(const CItem::ITEM_TYPE itemType, const int nAmount)
+{
+	m_Inventory.Add(itemType, nAmount);
 }
 
 /****************************************//*
@@ -488,7 +485,8 @@ void CHuman::HoldItem(CItem* pItem)
 *//****************************************/
 void CHuman::SetHumanJob(std::unique_ptr<IJob_Strategy> job)
 {
-	// EƐ؂ւ̏
+	// EƐ؂ւ̏ixe{݂̘gj
+	m_pJob->OnStopWork();
 	m_pJob->OnChangeJob();
 
 	// eIuWFNgݒ
@@ -499,6 +497,9 @@ void CHuman::SetHumanJob(std::unique_ptr<IJob_Strategy> job)
 	
 	// IuWFNgݒ
 	m_pJob = std::move(job);
+
+	// EƂς̂ŏԂɌ肵
+	CDecisionScheduler::GetInstance()->RequestDecision(this);
 }
 
 /****************************************//*
@@ -551,84 +552,71 @@ void CHuman::GoHomeAndRest()
 void CHuman::GoEatFood()
 {
 	// Ă钲ςݐHACeT
-	const CItem* pFoodItem = TakeOutItem(CItem::ITEM_CATEGORY::CookedFood);
+	CItem::ITEM_TYPE eFoodType = TakeOutItem(CItem::ITEM_CATEGORY::CookedFood);
 
 	// ςݐHACeΐHׂ
-	if (pFoodItem == nullptr)
+	if (eFoodType == CItem::ITEM_TYPE::MAX)
 	{
 		// Ă関HACeT
-		pFoodItem = TakeOutItem(CItem::ITEM_CATEGORY::UnCookedFood);
+		eFoodType = TakeOutItem(CItem::ITEM_CATEGORY::UnCookedFood);
 	}
 
-	// HACe̒猩Ȃꍇ͑qɂTɍs
-	if(pFoodItem == nullptr)
+	// ĂHACeHׂ
+	if (eFoodType != CItem::ITEM_TYPE::MAX)
 	{
-		// ԋ߂ɂT
-		CStorageHouse* pStorageHouse = GetScene()->GetGameObject<CStorageHouse>();
+		EatFood(eFoodType);
+		return;
+	}
 
-		// Ȃꍇ͏I
-		if (pStorageHouse == nullptr)return;
+	// HACe̒猩Ȃꍇ͑qɂTɍs
+	// ԋ߂ɂT
+	CStorageHouse* pStorageHouse = GetScene()->GetGameObject<CStorageHouse>();
 
-		// ɂ̈ʒu擾
-		DirectX::XMFLOAT3 f3StoragePos = pStorageHouse->GetPos();
-		// ̈ʒu擾
-		DirectX::XMFLOAT3 f3MyPos = m_tParam.m_f3Pos;
+	// Ȃꍇ͏I
+	if (pStorageHouse == nullptr)return;
 
-		// vZ
-		float fDistance = StructMath::Distance(f3StoragePos, f3MyPos);
+	// ɂ̈ʒu擾
+	DirectX::XMFLOAT3 f3StoragePos = pStorageHouse->GetPos();
+	// ̈ʒu擾
+	DirectX::XMFLOAT3 f3MyPos = m_tParam.m_f3Pos;
 
-		// ɂ͈͊Oɂꍇ͈ړ
-		if (fDistance > 1.0f)
-		{
-			// ɂ̕vZ
-			DirectX::XMFLOAT3 f3Direction = f3StoragePos - f3MyPos;
-			// K
-			f3Direction = StructMath::Normalize(f3Direction);
-			f3MyPos += f3Direction * Human_Move_Speed;
-			// ʒuXV
-			m_tParam.m_f3Pos = f3MyPos;
-			return;
-		}
+	// vZ
+	float fDistance = StructMath::Distance(f3StoragePos, f3MyPos);
 
-		// ɂ̋߂ɂꍇ͐HT
-		pFoodItem = pStorageHouse->TakeOutItem(CItem::ITEM_CATEGORY::CookedFood);
-		// ςݐHACeΐHׂ
-		if (pFoodItem == nullptr)
-		{
-			// Ă関HACeT
-			pFoodItem = pStorageHouse->TakeOutItem(CItem::ITEM_CATEGORY::UnCookedFood);
-		}
+	// ɂ͈͊Oɂꍇ͈ړ
+	if (fDistance > 1.0f)
+	{
+		// ɂ̕vZ
+		DirectX::XMFLOAT3 f3Direction = f3StoragePos - f3MyPos;
+		// K
+		f3Direction = StructMath::Normalize(f3Direction);
+		f3MyPos += f3Direction * Human_Move_Speed;
+		// ʒuXV
+		m_tParam.m_f3Pos = f3MyPos;
+		return;
+	}
 
-		// HACe
-		if (pFoodItem)
-		{
-			// HACẽJeS[ɂċ󕠓x񕜗ʂς
-			switch (pFoodItem->GetItemCategory())
-			{
-				// HACe
-			case CItem::ITEM_CATEGORY::UnCookedFood:
-				// HACeHׂ(0.5{)
-				m_fHunger += CItem::GetHungerRecoveryValue(pFoodItem->GetItemType()) * Human_UnCookedFood_Hunger_Recovery_Multiplier;
-				break;
-				// ςݐHACe
-			case CItem::ITEM_CATEGORY::CookedFood:
-				// HACeHׂ({)
-				m_fHunger += CItem::GetHungerRecoveryValue(pFoodItem->GetItemType());
-				break;
-			}
-			// 󕠓xől𒴂Ȃ悤ɕ␳
-			if (m_fHunger > Max_Hunger)
-			{
-				m_fHunger = Max_Hunger;
-			}
-		}
-		// HȂꍇ͎dԂɈڍs
-		else
-		{
-			m_eState = CHuman::HUMAN_STATE::Working;
-		}
+	// ɂ̋߂ɂꍇ͐HT
+	const CItem* pFoodItem = pStorageHouse->TakeOutItem(CItem::ITEM_CATEGORY::CookedFood);
+	// ςݐHACeΐHׂ
+	if (pFoodItem == nullptr)
+	{
+		// Ă関HACeT
+		pFoodItem = pStorageHouse->TakeOutItem(CItem::ITEM_CATEGORY::UnCookedFood);
+	}
+
+	// HACe
+	if (pFoodItem)
+	{
+		// HACeHׂ
+		EatFood(pFoodItem->GetItemType());
+		delete pFoodItem;
+	}
+	// HȂꍇ͎dԂɈڍs
+	else
+	{
+		m_eState = CHuman::HUMAN_STATE::Working;
 	}
-	
 }
 
 /****************************************//*
@@ -637,18 +625,39 @@ void CHuman::GoEatFood()
 *//****************************************/
 bool CHuman::HasFood() const
 {
-	// ĂHACeT
-	for (const CItem* pItem : m_ItemList)
+	// JeS[Ƃ̍vŔ
+	return m_Inventory.GetCategoryCount(CItem::ITEM_CATEGORY::CookedFood) > 0 ||
+		m_Inventory.GetCategoryCount(CItem::ITEM_CATEGORY::UnCookedFood) > 0;
+}
+
+/****************************************//*
+	@brief@	| HACeHׂ鏈
+	@param		| eFoodTypeFHׂHACe^Cv
+	@note		| HACẽJeS[ɂċ󕠓x񕜗ʂς
+*//****************************************/
+void CHuman::EatFood(const CItem::ITEM_TYPE eFoodType)
+{
+	switch (CItem::GetItemCategoryFromType(eFoodType))
 	{
-		if (pItem->GetItemCategory() == CItem::ITEM_CATEGORY::CookedFood ||
-			pItem->GetItemCategory() == CItem::ITEM_CATEGORY::UnCookedFood)
-		{
-			return true;
-		}
+		// HACe
+	case CItem::ITEM_CATEGORY::UnCookedFood:
+		// HACeHׂ(0.5{)
+		RecoverHunger(CItem::GetHungerRecoveryValue(eFoodType) * Human_UnCookedFood_Hunger_Recovery_Multiplier);
+		break;
+		// ςݐHACe
+	case CItem::ITEM_CATEGORY::CookedFood:
+		// HACeHׂ({)
+		RecoverHunger(CItem::GetHungerRecoveryValue(eFoodType));
+		break;
+	default:
+		break;
 	}
 
-	// ĂȂꍇfalseԂ
-	return false;
+	// ɂȂ玟̏ԂɌ肷
+	if (IsFullHunger())
+	{
+		CDecisionScheduler::GetInstance()->RequestDecision(this);
+	}
 }
 
 /****************************************//*
@@ -8,6 +8,7 @@
 #include "Entity.h"
 #include "JobOperator.h"
 #include "Item.h"
+#include "ItemInventory.h"
 #include <memory>
 #include "BillboardRenderer.h"
 #include "Skill.h"
@@ -76,33 +77,44 @@ public:
 
 	// @brief ACeĂ邩ǂ
 	// @return true:Ă false:ĂȂ
-	bool HasItem() const { return !m_ItemList.empty(); }
+	bool HasItem() const { return !m_Inventory.IsEmpty(); }
 
 	// @brief ACe̎擾
 	// @return ĂACe
-	int GetItemCount() const { return static_cast<int>(m_ItemList.size()); }
+	int GetItemCount() const { return m_Inventory.GetTotalCount(); }
 
-	// @brief ACeXg̎擾
-	std::vector<CItem*> GetItemList() { return m_ItemList; }
+	// @brief ACe^CvƂ̏̎擾
+	// @param itemTypeFACe^Cv
+	// @return Ă
+	int GetItemCount(const CItem::ITEM_TYPE itemType) const { return m_Inventory.GetCount(itemType); }
 
-	// @brief ACe肾
-	// @return oACe|C^AĂȂꍇnullptr
-	CItem* TakeOutItem();
+	// @brief ACe̎擾
+	CItemInventory& GetInventory() { return m_Inventory; }
+	const CItemInventory& GetInventory() const { return m_Inventory; }
 
 	// @brief ACeo
 	// @param itemTypeFoACe^Cv
-	// @return oACe|C^AĂȂꍇnullptr
-	const CItem* TakeOutItem(const CItem::ITEM_TYPE itemType);
+	// @return true:o false:ĂȂ
+	bool TakeOutItem(const CItem::ITEM_TYPE itemType);
 
 	// @brief ACeo
 	// @param itemCategoryFoACeJeS[
-	// @return oACe|C^AĂȂꍇnullptr
-	const CItem* TakeOutItem(const CItem::ITEM_CATEGORY itemCategory);
+	// @return oACe^CvAĂȂꍇITEM_TYPE::MAX
+	CItem::ITEM_TYPE TakeOutItem(const CItem::ITEM_CATEGORY itemCategory);
 
 	// @brief ACe
 	// @param pItemFACe|C^
+	// @note ƂċL^AACe|C^͉
 	void HoldItem(CItem* pItem);
 
+	// @brief ACe܂Ƃ߂ď
+	// @param itemTypeFACe^Cv
+	// @param nAmountF
+	void HoldItem(const CItem::ITEM_TYPE itemType, const int nAmount);
+
+	// @brief ĂACeSĎ
+	void ClearItems() { m_Inventory.Clear(); }
+
 	// @brief EƃXgeW[̎擾
 	IJob_Strategy* GetHumanJob() const { return m_pJob.get(); }
 
@@ -132,6 +144,19 @@ public:
 	// @brief XL|C^̎擾
 	CSkill* GetSkill() const { return m_pSkill.get(); }
 
+	// @brief Ԃ̌菈
+	// @note ԌXPW[[琔t[ɈxA܂̓CxgŗvꂽɌĂ΂
+	void DecideState();
+
+	// @brief Ԃ̌vς݂ǂ̎擾
+	bool IsDecisionRequested() const { return m_isDecisionRequested; }
+	// @brief Ԃ̌vς݂ǂ̐ݒ
+	void SetDecisionRequested(bool isRequested) { m_isDecisionRequested = isRequested; }
+
+	// @brief lCxg̒ʒm
+	// @param eEventFCxg̎
+	void OnVitalsEvent(CVitalsManager::VitalsEvent eEvent) override;
+
 private:
 
 	// @brief ƂɋAċxޏ
@@ -140,6 +165,10 @@ private:
 	// @brief HוHׂɍs
 	void GoEatFood();
 
+	// @brief HACeHׂ鏈
+	// @param eFoodTypeFHׂHACe^Cv
+	void EatFood(const CItem::ITEM_TYPE eFoodType);
+
 private:
 	// @brief lԂ̏
 	HUMAN_STATE m_eState;
@@ -155,8 +184,8 @@ private:
 	// @brief c[𒙑ɂɖ߂ǂ̃tO
 	bool m_isReturnToolToStorage = false;
 
-	// @brief ACeXg
-	std::vector<CItem*> m_ItemList;
+	// @brief ACeiACe^CvƂ̌j
+	CItemInventory m_Inventory;
 
 	// @brief X^~iQ[Wr{[h
 	// 0: wi, 1: Q[W{
@@ -167,5 +196,8 @@ private:
 	// @brief Ƃŋxeǂ
 	bool m_isRestingAtHome = false;
 
+	// @brief Ԃ̌vς݂ǂ
+	bool m_isDecisionRequested = false;
+
 };
 
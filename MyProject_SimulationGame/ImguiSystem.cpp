@@ -648,8 +648,7 @@ void CImguiSystem::DrawStoragehouseItem()
 
 			if (ImGui::Button((u8"ǉ:" + itemName).c_str()))
 			{
-				CItem* pItem = new CItem(type);
-				pStorageHouse->StoreItem(pItem);
+				pStorageHouse->StoreItem(type);
 			}
 		}
 	}
@@ -742,7 +741,7 @@ void CImguiSystem::DrawGenerateRequestList()
 	// }l[W[̃CX^X擾
 	CGeneratorManager* pGeneratorManager = CGeneratorManager::GetInstance();
 
-	for(auto& request : pGeneratorManager->GetGenerateRequestList())
+	for(const auto& request : pGeneratorManager->GetGenerateRequestList())
 	{
 		ImGui::BeginChild(ImGui::GetID((void*)&request), ImVec2(280, 80), ImGuiWindowFlags_NoTitleBar);
 
@@ -755,13 +754,19 @@ void CImguiSystem::DrawGenerateRequestList()
 		case CGeneratorManager::GenerateType::Stone:
 			strType += "";
 			break;
+		case CGeneratorManager::GenerateType::Grass:
+			strType += "";
+			break;
 		case CGeneratorManager::GenerateType::Human:
 			strType += "l";
 			break;
+		case CGeneratorManager::GenerateType::Animal:
+			strType += "";
+			break;
 		}
 		ImGui::Text(strType.c_str());
 
-		ImGui::Text(u8"܂ł̎: %.2f", request.m_fGenerateTime);
+		ImGui::Text(u8"܂ł̎: %.2f", pGeneratorManager->GetRemainingTime(request));
 
 		ImGui::EndChild();
 	}
@@ -1099,19 +1104,16 @@ void CImguiSystem::Release_DrawHuman()
 	// ACeXg̕\
 	ImGui::Separator();
 	ImGui::Text(u8"[ACe]");
-	const auto& itemList = m_pHumanObject->GetItemList();
+	const CItemInventory& inventory = m_pHumanObject->GetInventory();
 
 	ImGui::BeginChild(ImGui::GetID((void*)0), ImVec2(580, 300), ImGuiWindowFlags_NoTitleBar);
 
-	// ACe^CvʂɃJEgĕ\
-	std::unordered_map<std::string, int> itemCountMap;
-	for (const auto& item : itemList)
-	{
-		itemCountMap[CItem::ITEM_TYPE_TO_STRING(item->GetItemType())]++;
-	}
-	for (const auto& pair : itemCountMap)
+	// ACe^Cvʂ̏\
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
 	{
-		ImGui::Text("%s: %d", pair.first.c_str(), pair.second);
+		CItem::ITEM_TYPE eType = static_cast<CItem::ITEM_TYPE>(i);
+		if (inventory.GetCount(eType) <= 0) continue;
+		ImGui::Text("%s: %d", CItem::ITEM_TYPE_TO_STRING(eType).c_str(), inventory.GetCount(eType));
 	}
 
 	ImGui::EndChild();
@@ -5,6 +5,8 @@
 *//**************************************************/
 #pragma once
 #include <string>
+#include <vector>
+#include <cstddef>
 
 // @brief ACeNX
 class CItem
@@ -100,7 +102,7 @@ public:
 	}
 
 	// @brief ACe^CvACeJeS[擾֐
-	static ITEM_CATEGORY GetItemCategoryFromType(ITEM_TYPE eType)
+	static constexpr ITEM_CATEGORY GetItemCategoryFromType(ITEM_TYPE eType)
 	{
 		switch (eType)
 		{
@@ -135,6 +137,52 @@ public:
 		int nRequiredAmount;			// Kv
 	};
 
+	// @brief 1̃VsɊ܂߂fނ̍őސ
+	static constexpr int MAX_RECIPE_MATERIALS = 4;
+
+	// @brief Œ蒷̑fރXg\
+	// @note Vse[uconstexprŎ߂Ƀq[vgȂ
+	struct Recipe
+	{
+		Material aMaterials[MAX_RECIPE_MATERIALS];	// f
+		int nCount;									// Lȑfސ
+
+		// @brief fނ̒ǉ
+		// @return true:ǉ false:eʕs
+		constexpr bool Push(const Material& material)
+		{
+			if (nCount >= MAX_RECIPE_MATERIALS) return false;
+			aMaterials[nCount++] = material;
+			return true;
+		}
+
+		constexpr const Material* begin() const { return aMaterials; }
+		constexpr const Material* end() const { return aMaterials + nCount; }
+		constexpr size_t size() const { return static_cast<size_t>(nCount); }
+		constexpr bool empty() const { return nCount == 0; }
+	};
+
+	// @brief fރXg̎QƁiLȂj
+	// @note RecipeAstd::vector̂ǂ炩ł\złARs[Ămۂ͔Ȃ
+	class MaterialSpan
+	{
+	public:
+		constexpr MaterialSpan() : m_pData(nullptr), m_nSize(0) {}
+		constexpr MaterialSpan(const Material* pData, size_t nSize) : m_pData(pData), m_nSize(nSize) {}
+		constexpr MaterialSpan(const Recipe& recipe) : m_pData(recipe.aMaterials), m_nSize(recipe.size()) {}
+		MaterialSpan(const std::vector<Material>& materials) : m_pData(materials.data()), m_nSize(materials.size()) {}
+
+		constexpr const Material* begin() const { return m_pData; }
+		constexpr const Material* end() const { return m_pData + m_nSize; }
+		constexpr size_t size() const { return m_nSize; }
+		constexpr bool empty() const { return m_nSize == 0; }
+		constexpr const Material& operator[](size_t nIndex) const { return m_pData[nIndex]; }
+
+	private:
+		const Material* m_pData;	// 擪vf
+		size_t m_nSize;				// vf
+	};
+
 public:
 	// @brief RXgN^
 	// @param In_eTypeFACe^Cv
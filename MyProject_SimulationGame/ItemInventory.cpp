@@ -0,0 +1,181 @@
+/**************************************************//*
+	@file	| ItemInventory.cpp
+	@brief	| ACeǗNXcppt@C
+	@note	| ACe̂ł͂ȂACe^CvƂ̌ŊǗ
+			| JeS[Ƃ̍vɍXVA₢킹萔Ԃōs
+*//**************************************************/
+#include "ItemInventory.h"
+
+/****************************************//*
+	@brief@	| RXgN^
+*//****************************************/
+CItemInventory::CItemInventory()
+	: m_nTypeCounts{}
+	, m_nCategoryCounts{}
+	, m_nTotalCount(0)
+{
+}
+
+/****************************************//*
+	@brief@	| fXgN^
+*//****************************************/
+CItemInventory::~CItemInventory()
+{
+}
+
+/****************************************//*
+	@brief@	| ACeǉ
+	@param		| eTypeFǉACe^Cv
+	@param		| nAmountFǉ
+*//****************************************/
+void CItemInventory::Add(const CItem::ITEM_TYPE eType, const int nAmount)
+{
+	if (nAmount <= 0 || eType >= CItem::ITEM_TYPE::MAX) return;
+
+	m_nTypeCounts[static_cast<int>(eType)] += nAmount;
+	m_nCategoryCounts[static_cast<int>(CItem::GetItemCategoryFromType(eType))] += nAmount;
+	m_nTotalCount += nAmount;
+}
+
+/****************************************//*
+	@brief@	| ACe菜
+	@param		| eTypeF菜ACe^Cv
+	@param		| nAmountF菜
+	@return		| true:菜 false:Ȃi菜Ȃj
+*//****************************************/
+bool CItemInventory::Remove(const CItem::ITEM_TYPE eType, const int nAmount)
+{
+	if (eType >= CItem::ITEM_TYPE::MAX) return false;
+	if (nAmount <= 0) return true;
+
+	// Ȃꍇ͉Ȃ
+	int& nCount = m_nTypeCounts[static_cast<int>(eType)];
+	if (nCount < nAmount) return false;
+
+	nCount -= nAmount;
+	m_nCategoryCounts[static_cast<int>(CItem::GetItemCategoryFromType(eType))] -= nAmount;
+	m_nTotalCount -= nAmount;
+	return true;
+}
+
+/****************************************//*
+	@brief@	| fރXg܂Ƃ߂Ď菜
+	@param		| materialsF菜fރXg
+	@return		| true:SĎ菜 false:si菜Ȃj
+*//****************************************/
+bool CItemInventory::Remove(const CItem::MaterialSpan& materials)
+{
+	// ɑSđĂ邩mFĂ菜
+	if (!HasMaterials(materials)) return false;
+
+	for (const CItem::Material& material : materials)
+	{
+		Remove(material.eItemType, material.nRequiredAmount);
+	}
+	return true;
+}
+
+/****************************************//*
+	@brief@	| ʂ̏ǗփACeڂ
+	@param		| destFړ
+	@param		| eTypeFڂACe^Cv
+	@param		| nAmountFڂő
+	@return		| ۂɈڂ
+*//****************************************/
+int CItemInventory::Transfer(CItemInventory& dest, const CItem::ITEM_TYPE eType, const int nAmount)
+{
+	if (eType >= CItem::ITEM_TYPE::MAX || &dest == this) return 0;
+
+	// 𒴂Ȃ͈͂ňڂ
+	const int nCount = GetCount(eType);
+	const int nMove = nAmount < nCount ? nAmount : nCount;
+	if (nMove <= 0) return 0;
+
+	Remove(eType, nMove);
+	dest.Add(eType, nMove);
+	return nMove;
+}
+
+/****************************************//*
+	@brief@	| ʂ̏Ǘ֑SẴACeڂ
+	@param		| destFړ
+	@return		| ڂ
+*//****************************************/
+int CItemInventory::TransferAll(CItemInventory& dest)
+{
+	if (&dest == this) return 0;
+
+	const int nMoved = m_nTotalCount;
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
+	{
+		dest.Add(static_cast<CItem::ITEM_TYPE>(i), m_nTypeCounts[i]);
+	}
+	Clear();
+	return nMoved;
+}
+
+/****************************************//*
+	@brief@	| ꂩ̃ACe1o
+	@return		| oACe^CvȀꍇITEM_TYPE::MAX
+*//****************************************/
+CItem::ITEM_TYPE CItemInventory::TakeAny()
+{
+	if (IsEmpty()) return CItem::ITEM_TYPE::MAX;
+
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
+	{
+		if (m_nTypeCounts[i] > 0)
+		{
+			CItem::ITEM_TYPE eType = static_cast<CItem::ITEM_TYPE>(i);
+			Remove(eType);
+			return eType;
+		}
+	}
+	return CItem::ITEM_TYPE::MAX;
+}
+
+/****************************************//*
+	@brief@	| wJeS[̃ACe1o
+	@param		| eCategoryFoACeJeS[
+	@return		| oACe^CvAꍇITEM_TYPE::MAX
+*//****************************************/
+CItem::ITEM_TYPE CItemInventory::TakeByCategory(const CItem::ITEM_CATEGORY eCategory)
+{
+	// JeS[̍v0Ȃ瑖Ȃ
+	if (GetCategoryCount(eCategory) <= 0) return CItem::ITEM_TYPE::MAX;
+
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
+	{
+		CItem::ITEM_TYPE eType = static_cast<CItem::ITEM_TYPE>(i);
+		if (m_nTypeCounts[i] > 0 && CItem::GetItemCategoryFromType(eType) == eCategory)
+		{
+			Remove(eType);
+			return eType;
+		}
+	}
+	return CItem::ITEM_TYPE::MAX;
+}
+
+/****************************************//*
+	@brief@	| SẴACej
+*//****************************************/
+void CItemInventory::Clear()
+{
+	m_nTypeCounts.fill(0);
+	m_nCategoryCounts.fill(0);
+	m_nTotalCount = 0;
+}
+
+/****************************************//*
+	@brief@	| fރXg𖞂Ă邩ǂ擾
+	@param		| materialsFKvfރXg
+	@return		| true:SĖĂ false:s
+*//****************************************/
+bool CItemInventory::HasMaterials(const CItem::MaterialSpan& materials) const
+{
+	for (const CItem::Material& material : materials)
+	{
+		if (GetCount(material.eItemType) < material.nRequiredAmount) return false;
+	}
+	return true;
+}
@@ -0,0 +1,98 @@
+/**************************************************//*
+	@file	| ItemInventory.h
+	@brief	| ACeǗNXht@C
+	@note	| ACe̂ł͂ȂACe^CvƂ̌ŊǗ
+			| JeS[Ƃ̍vɍXVA₢킹萔Ԃōs
+*//**************************************************/
+#pragma once
+#include "Item.h"
+#include <array>
+#include <vector>
+
+// @brief ACeǗNX
+class CItemInventory
+{
+public:
+	// @brief RXgN^
+	CItemInventory();
+
+	// @brief fXgN^
+	~CItemInventory();
+
+	// @brief ACeǉ
+	// @param eTypeFǉACe^Cv
+	// @param nAmountFǉ
+	void Add(const CItem::ITEM_TYPE eType, const int nAmount = 1);
+
+	// @brief ACe菜
+	// @param eTypeF菜ACe^Cv
+	// @param nAmountF菜
+	// @return true:菜 false:Ȃi菜Ȃj
+	bool Remove(const CItem::ITEM_TYPE eType, const int nAmount = 1);
+
+	// @brief fރXg܂Ƃ߂Ď菜
+	// @param materialsF菜fރXg
+	// @return true:SĎ菜 false:si菜Ȃj
+	bool Remove(const CItem::MaterialSpan& materials);
+
+	// @brief ʂ̏ǗփACeڂ
+	// @param destFړ
+	// @param eTypeFڂACe^Cv
+	// @param nAmountFڂő
+	// @return ۂɈڂ
+	int Transfer(CItemInventory& dest, const CItem::ITEM_TYPE eType, const int nAmount);
+
+	// @brief ʂ̏Ǘ֑SẴACeڂ
+	// @param destFړ
+	// @return ڂ
+	int TransferAll(CItemInventory& dest);
+
+	// @brief ꂩ̃ACe1o
+	// @return oACe^CvȀꍇITEM_TYPE::MAX
+	CItem::ITEM_TYPE TakeAny();
+
+	// @brief wJeS[̃ACe1o
+	// @param eCategoryFoACeJeS[
+	// @return oACe^CvAꍇITEM_TYPE::MAX
+	CItem::ITEM_TYPE TakeByCategory(const CItem::ITEM_CATEGORY eCategory);
+
+	// @brief SẴACej
+	void Clear();
+
+	// @brief ACe^CvƂ̌擾
+	// @note ȃACe^Cv0Ԃ
+	int GetCount(const CItem::ITEM_TYPE eType) const
+	{
+		if (eType >= CItem::ITEM_TYPE::MAX) return 0;
+		return m_nTypeCounts[static_cast<int>(eType)];
+	}
+
+	// @brief ACeJeS[Ƃ̍v擾
+	// @note ȃACeJeS[0Ԃ
+	int GetCategoryCount(const CItem::ITEM_CATEGORY eCategory) const
+	{
+		if (eCategory >= CItem::ITEM_CATEGORY::MAX) return 0;
+		return m_nCategoryCounts[static_cast<int>(eCategory)];
+	}
+
+	// @brief SACe̍v擾
+	int GetTotalCount() const { return m_nTotalCount; }
+
+	// @brief 󂩂ǂ擾
+	bool IsEmpty() const { return m_nTotalCount == 0; }
+
+	// @brief fރXg𖞂Ă邩ǂ擾
+	// @param materialsFKvfރXg
+	// @return true:SĖĂ false:s
+	bool HasMaterials(const CItem::MaterialSpan& materials) const;
+
+private:
+	// @brief ACe^CvƂ̌
+	std::array<int, static_cast<int>(CItem::ITEM_TYPE::MAX)> m_nTypeCounts;
+
+	// @brief ACeJeS[Ƃ̍v
+	std::array<int, static_cast<int>(CItem::ITEM_CATEGORY::MAX)> m_nCategoryCounts;
+
+	// @brief SACe̍v
+	int m_nTotalCount;
+};
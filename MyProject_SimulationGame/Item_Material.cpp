@@ -4,54 +4,205 @@
 	@note	| 쐬Ƃ̑fނɊւǗNX̎
 *//**************************************************/
 #include "Item_Material.h"
+#include <fstream>
+#include <nlohmann/json.hpp>
 
+// @brief sɎQƂ铹̑fރe[uilŏAOt@Cŏ㏑\j
+static MaterialTable::ItemRecipeTable g_ToolTable = ToolMaterials::DEFAULT_TABLE;
+
+// @brief sɎQƂ錚z̑fރe[u
+static MaterialTable::BuildRecipeTable g_BuildTable = BuildMaterials::DEFAULT_TABLE;
+
+// @brief sɎQƂ闿̑fރe[u
+static MaterialTable::ItemRecipeTable g_CookTable = CookMaterials::DEFAULT_TABLE;
+
+// @brief Ot@CŎgpACe^CviITEM_TYPE̕яj
+static const char* const ITEM_TYPE_KEYS[] = {
+	"Wood", "Stone", "Iron", "Fiber",
+	"WheatSeed",
+	"Pickaxe", "Axe", "Sickle",
+	"Apple", "Sugar", "ApplePie", "Wheat", "Bread",
+};
+static_assert(sizeof(ITEM_TYPE_KEYS) / sizeof(ITEM_TYPE_KEYS[0]) == MaterialTable::ITEM_TYPE_NUM, "ITEM_TYPE_KEYSITEM_TYPEƈvĂ܂");
+
+// @brief Ot@CŎgp錚z^CviBuildType̕яj
+static const char* const BUILD_TYPE_KEYS[] = {
+	"RefreshFacility", "HumanHouse", "BlackSmith", "FoodFactory", "FarmFacility",
+};
+static_assert(sizeof(BUILD_TYPE_KEYS) / sizeof(BUILD_TYPE_KEYS[0]) == MaterialTable::BUILD_TYPE_NUM, "BUILD_TYPE_KEYSBuildTypeƈvĂ܂");
+
+/****************************************//*
+	@brief@	| Oe[ũCfbNX擾
+	@param@	| pKeysFO̔z
+	@param@	| nNumFz̗vf
+	@param@	| nameFTO
+	@return@	| CfbNXAȂꍇ-1
+*//****************************************/
+static int FindKeyIndex(const char* const* pKeys, int nNum, const std::string& name)
+{
+	for (int i = 0; i < nNum; ++i)
+	{
+		if (name == pKeys[i]) return i;
+	}
+	return -1;
+}
+
+/****************************************//*
+	@brief@	| JSON̑fޔzVsɕϊ
+	@param@	| jsonFfޔz [ { "Item" : "Wood", "Amount" : 5 }, ... ]
+	@param@	| outRecipeFϊVs
+	@return@	| true:ϊ false:s
+*//****************************************/
+static bool ParseRecipe(const nlohmann::json& json, CItem::Recipe& outRecipe)
+{
+	if (!json.is_array()) return false;
+
+	CItem::Recipe recipe{};
+	for (const nlohmann::json& material : json)
+	{
+		if (!material.is_object()) return false;
+
+		auto itItem = material.find("Item");
+		auto itAmount = material.find("Amount");
+		if (itItem == material.end() || !itItem->is_string()) return false;
+		if (itAmount == material.end() || !itAmount->is_number_integer()) return false;
+
+		int nItemIndex = FindKeyIndex(ITEM_TYPE_KEYS, MaterialTable::ITEM_TYPE_NUM, itItem->get<std::string>());
+		int nAmount = itAmount->get<int>();
+		if (nItemIndex < 0 || nAmount <= 0) return false;
+
+		// eʂ𒴂ꍇ͕s
+		if (!recipe.Push({ static_cast<CItem::ITEM_TYPE>(nItemIndex), nAmount })) return false;
+	}
+
+	outRecipe = recipe;
+	return true;
+}
+
+/****************************************//*
+	@brief@	| ACe^CvňVse[ȕ㏑
+	@param@	| jsonF{ "ACe" : fޔz, ... }
+	@param@	| tableF㏑e[u
+	@return@	| true: false:s
+*//****************************************/
+static bool ParseItemRecipeTable(const nlohmann::json& json, MaterialTable::ItemRecipeTable& table)
+{
+	if (!json.is_object()) return false;
+
+	for (auto it = json.begin(); it != json.end(); ++it)
+	{
+		int nIndex = FindKeyIndex(ITEM_TYPE_KEYS, MaterialTable::ITEM_TYPE_NUM, it.key());
+		if (nIndex < 0) return false;
+		if (!ParseRecipe(it.value(), table[nIndex])) return false;
+	}
+	return true;
+}
+
+/****************************************//*
+	@brief@	| Ot@C烌Vs㏑ǂݍ
+	@param@	| pFilePathFJSONt@CpX
+	@return@	| true:㏑ false:t@CA܂͕sȓêߊl̂܂
+	@note@		| SĐǂݍ߂ꍇ̂݃e[uu
+*//****************************************/
+bool MaterialTable::LoadOverrides(const char* pFilePath)
+{
+	// t@Cꍇ͊l̂܂
+	std::ifstream file(pFilePath);
+	if (!file.is_open()) return false;
+
+	// Og킸ɉ
+	nlohmann::json root = nlohmann::json::parse(file, nullptr, false);
+	if (root.is_discarded() || !root.is_object())
+	{
+		MessageBox(nullptr, "fރt@C̏sł", "Error", MB_OK);
+		return false;
+	}
+
+	// Ɨp̃e[uɓǂݍ
+	ItemRecipeTable toolTable = g_ToolTable;
+	BuildRecipeTable buildTable = g_BuildTable;
+	ItemRecipeTable cookTable = g_CookTable;
+	bool bSuccess = true;
+
+	// 
+	auto itTool = root.find("Tool");
+	if (itTool != root.end()) bSuccess &= ParseItemRecipeTable(*itTool, toolTable);
+
+	// 
+	auto itCook = root.find("Cook");
+	if (itCook != root.end()) bSuccess &= ParseItemRecipeTable(*itCook, cookTable);
+
+	// zizx̑fޔzj
+	auto itBuild = root.find("Build");
+	if (itBuild != root.end())
+	{
+		if (!itBuild->is_object()) bSuccess = false;
+		else
+		{
+			for (auto it = itBuild->begin(); it != itBuild->end() && bSuccess; ++it)
+			{
+				int nIndex = FindKeyIndex(BUILD_TYPE_KEYS, BUILD_TYPE_NUM, it.key());
+				if (nIndex < 0 || !it->is_array() || static_cast<int>(it->size()) != CBuildObject::MAX_BUILD_LEVEL)
+				{
+					bSuccess = false;
+					break;
+				}
+
+				for (int nLevel = 0; nLevel < CBuildObject::MAX_BUILD_LEVEL && bSuccess; ++nLevel)
+				{
+					bSuccess &= ParseRecipe((*it)[nLevel], buildTable[nIndex][nLevel]);
+				}
+			}
+		}
+	}
+
+	if (!bSuccess)
+	{
+		MessageBox(nullptr, "fރt@C̓esł", "Error", MB_OK);
+		return false;
+	}
+
+	// Sēǂݍ߂ꍇ̂ݒu
+	g_ToolTable = toolTable;
+	g_BuildTable = buildTable;
+	g_CookTable = cookTable;
+	return true;
+}
 
 /****************************************//*
 	@brief@	| w肵̑fރXg擾֐
 	@param@	| eTypeF̃ACe^Cv
 	@return@	| w肵̑fރXg
 *//****************************************/
-std::vector<CItem::Material> ToolMaterials::GetToolMaterials(CItem::ITEM_TYPE eType)
+CItem::MaterialSpan ToolMaterials::GetToolMaterials(CItem::ITEM_TYPE eType)
 {
-	switch (eType)
+	int nIndex = MaterialTable::Index(eType);
+	if (nIndex < 0 || nIndex >= MaterialTable::ITEM_TYPE_NUM || g_ToolTable[nIndex].empty())
 	{
-	case CItem::ITEM_TYPE::Pickaxe:
-		return Pickaxe;
-	case CItem::ITEM_TYPE::Axe:
-		return Axe;
-	case CItem::ITEM_TYPE::Sickle:
-		return Sickle;
-	default:
 		MessageBox(nullptr, "^CṽP[XpӂĂ܂", "Error", MB_OK);
+		return CItem::MaterialSpan();
 	}
 
-	return std::vector<CItem::Material>();
+	return g_ToolTable[nIndex];
 }
 
 /*****************************************//*
 	@brief	| zfނ擾
 	@param	| eTypeFz^Cv
+	@param	| nLevelFzxi0zj
 	@return	| zfނ̔z
 *//*****************************************/
-std::vector<CItem::Material> BuildMaterials::GetBuildMaterials(CBuildManager::BuildType eType, int nLevel)
+CItem::MaterialSpan BuildMaterials::GetBuildMaterials(CBuildManager::BuildType eType, int nLevel)
 {
-	switch (eType)
+	int nIndex = MaterialTable::Index(eType);
+	if (nIndex < 0 || nIndex >= MaterialTable::BUILD_TYPE_NUM ||
+		nLevel < 0 || nLevel >= CBuildObject::MAX_BUILD_LEVEL)
 	{
-	case CBuildManager::BuildType::RefreshFacility:
-		return RefreshFacility[nLevel];
-	case CBuildManager::BuildType::HumanHouse:
-		return HumanHouse[nLevel];
-	case CBuildManager::BuildType::BlackSmith:
-		return BlackSmith[nLevel];
-	case CBuildManager::BuildType::FoodFactory:
-		return FoodFactory[nLevel];
-	case CBuildManager::BuildType::FarmFacility:
-		return FarmFacility[nLevel];
-	default:
 		MessageBox(nullptr, "^CṽP[XpӂĂ܂", "Error", MB_OK);
+		return CItem::MaterialSpan();
 	}
 
-	return std::vector<CItem::Material>();
+	return g_BuildTable[nIndex][nLevel];
 }
 
 /*****************************************//*
@@ -59,21 +210,16 @@ std::vector<CItem::Material> BuildMaterials::GetBuildMaterials(CBuildManager::Bu
 	@param	| eTypeFςݐH̃ACe^Cv
 	@return	| fނ̔z
 *//*****************************************/
-std::vector<CItem::Material> CookMaterials::GetCookMaterials(CItem::ITEM_TYPE eType)
+CItem::MaterialSpan CookMaterials::GetCookMaterials(CItem::ITEM_TYPE eType)
 {
-	switch (eType)
+	int nIndex = MaterialTable::Index(eType);
+	if (nIndex < 0 || nIndex >= MaterialTable::ITEM_TYPE_NUM || g_CookTable[nIndex].empty())
 	{
-	case CItem::ITEM_TYPE::Sugar:
-		return Sugar;
-	case CItem::ITEM_TYPE::ApplePie:
-		return ApplePie;
-	case CItem::ITEM_TYPE::Bread:
-		return Bread;
-	default:
 		MessageBox(nullptr, "^CṽP[XpӂĂ܂", "Error", MB_OK);
+		return CItem::MaterialSpan();
 	}
 
-    return std::vector<CItem::Material>();
+	return g_CookTable[nIndex];
 }
 
 /*****************************************//*
@@ -2,141 +2,249 @@
 	@file	| Item_Material.h
 	@brief	| fފǗ̃NXwb_
 	@note	| 쐬Ƃ̑fނɊւǗNX
+			| ̃VsconstexpřŒ蒷e[uŎA
+			| NɊOt@Cŏ㏑l𓯂zuŕێ
 *//**************************************************/
 #pragma once
 #include "Item.h"
+#include <array>
+#include <initializer_list>
 #include <vector>
 #include "BuildObject.h"
 #include "BuildManager.h"
 
+// @brief fރe[uʃf[^O
+namespace MaterialTable
+{
+	// @brief ACe^Cv̐
+	constexpr int ITEM_TYPE_NUM = static_cast<int>(CItem::ITEM_TYPE::MAX);
+
+	// @brief z^Cv̐
+	constexpr int BUILD_TYPE_NUM = static_cast<int>(CBuildManager::BuildType::MAX);
+
+	// @brief ACe^CvňVse[u
+	using ItemRecipeTable = std::array<CItem::Recipe, ITEM_TYPE_NUM>;
+
+	// @brief z^Cv~zxňVse[u
+	using BuildRecipeTable = std::array<std::array<CItem::Recipe, CBuildObject::MAX_BUILD_LEVEL>, BUILD_TYPE_NUM>;
+
+	// @brief 񋓌^e[ũCfbNXɕϊ
+	template<typename T>
+	constexpr int Index(T eType) { return static_cast<int>(eType); }
+
+	// @brief fރXg烌Vs𐶐
+	// @param materialsFfރXgiMAX_RECIPE_MATERIALS܂Łj
+	constexpr CItem::Recipe MakeRecipe(std::initializer_list<CItem::Material> materials)
+	{
+		CItem::Recipe recipe{};
+		for (const CItem::Material& material : materials)
+		{
+			// eʂ𒴂ꍇ̓RpCɔzOQƂŃG[ɂȂ
+			recipe.aMaterials[recipe.nCount++] = material;
+		}
+		return recipe;
+	}
+
+	// @brief wJeS[̑SACe^CvɃVso^Ă邩ǂ
+	// @param tableFACe^CvňVse[u
+	// @param eCategoryF肷ACeJeS[
+	constexpr bool HasEntryForCategory(const ItemRecipeTable& table, CItem::ITEM_CATEGORY eCategory)
+	{
+		for (int i = 0; i < ITEM_TYPE_NUM; ++i)
+		{
+			if (CItem::GetItemCategoryFromType(static_cast<CItem::ITEM_TYPE>(i)) != eCategory) continue;
+			if (table[i].empty()) return false;
+		}
+		return true;
+	}
+
+	// @brief SĂ̌z^Cv~zxɃVso^Ă邩ǂ
+	// @param tableFz^Cv~zxňVse[u
+	constexpr bool HasAllBuildEntries(const BuildRecipeTable& table)
+	{
+		for (int i = 0; i < BUILD_TYPE_NUM; ++i)
+		{
+			for (int j = 0; j < CBuildObject::MAX_BUILD_LEVEL; ++j)
+			{
+				if (table[i][j].empty()) return false;
+			}
+		}
+		return true;
+	}
+
+	// @brief Ot@C烌Vs㏑ǂݍ
+	// @param pFilePathFJSONt@CpX
+	// @return true:㏑ false:t@CA܂͕sȓêߊl̂܂
+	// @note 
+	//       {
+	//         "Tool"  : { "Axe"  : [ { "Item" : "Wood", "Amount" : 5 } ] },
+	//         "Cook"  : { "Bread": [ { "Item" : "Wheat", "Amount" : 3 } ] },
+	//         "Build" : { "HumanHouse" : [ [ { "Item" : "Wood", "Amount" : 50 } ], ...zx ] }
+	//       }
+	//       Lq̖Vs͊l̂܂
+	bool LoadOverrides(const char* pFilePath);
+}
+
 // @brief fރf[^O
 namespace ToolMaterials
 {
-	// @brief ̑fރXg
-	const std::vector<CItem::Material> Axe = {
-		{ CItem::ITEM_TYPE::Wood,  5 },
-		{ CItem::ITEM_TYPE::Iron,  2 }
-	};
-
-	// @brief ͂̑fރXg
-	const std::vector<CItem::Material> Pickaxe = {
-		{ CItem::ITEM_TYPE::Wood,  5 },
-		{ CItem::ITEM_TYPE::Iron,  3 }
-	};
-
-	// @brief ̑fރXg
-	const std::vector<CItem::Material> Sickle = {
-		{ CItem::ITEM_TYPE::Wood,  4 },
-		{ CItem::ITEM_TYPE::Iron,  2 }
-	};
+	// @brief ̑fރe[uiACe^CvňAȊO͋j
+	constexpr MaterialTable::ItemRecipeTable DEFAULT_TABLE = []()
+	{
+		MaterialTable::ItemRecipeTable table{};
+
+		// 
+		table[MaterialTable::Index(CItem::ITEM_TYPE::Axe)] = MaterialTable::MakeRecipe({
+			{ CItem::ITEM_TYPE::Wood,  5 },
+			{ CItem::ITEM_TYPE::Iron,  2 } });
+
+		// ͂
+		table[MaterialTable::Index(CItem::ITEM_TYPE::Pickaxe)] = MaterialTable::MakeRecipe({
+			{ CItem::ITEM_TYPE::Wood,  5 },
+			{ CItem::ITEM_TYPE::Iron,  3 } });
+
+		// 
+		table[MaterialTable::Index(CItem::ITEM_TYPE::Sickle)] = MaterialTable::MakeRecipe({
+			{ CItem::ITEM_TYPE::Wood,  4 },
+			{ CItem::ITEM_TYPE::Iron,  2 } });
+
+		return table;
+	}();
+
+	// SĂ̓ɃVso^Ă邩
+	static_assert(MaterialTable::HasEntryForCategory(DEFAULT_TABLE, CItem::ITEM_CATEGORY::Tool), "̑fރe[uɖo^̓܂");
 
 	// @brief w肳ꂽ^Cv̑fރXg擾
-	std::vector<CItem::Material> GetToolMaterials(CItem::ITEM_TYPE eType);
+	// @note e[uւ̎QƂԂߊmۂ͔Ȃ
+	CItem::MaterialSpan GetToolMaterials(CItem::ITEM_TYPE eType);
 }
 
 // @brief zfރf[^O
 namespace BuildMaterials
 {
-	// @brief xeɕKvȑf
-	const std::vector<CItem::Material> RefreshFacility[CBuildObject::MAX_BUILD_LEVEL] =
-	{
-		// Level 1(z)
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 }},
-		// Level 2
-		{{ CItem::ITEM_TYPE::Wood,  10 },{ CItem::ITEM_TYPE::Stone,   10 }},
-		// Level 3
-		{{ CItem::ITEM_TYPE::Wood,  15 },{ CItem::ITEM_TYPE::Stone,   15 }},
-		// Level 4
-		{{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,   20 }},
-		// Level 5
-		{{ CItem::ITEM_TYPE::Wood,  25 },{ CItem::ITEM_TYPE::Stone,   25 }},
-	};
-
-	// @brief lԂ̉ƂɕKvȑf
-	const std::vector<CItem::Material> HumanHouse[CBuildObject::MAX_BUILD_LEVEL] =
-	{
-		// Level 1(z)
-		{{ CItem::ITEM_TYPE::Wood,  50 },{ CItem::ITEM_TYPE::Stone,   20 }},
-		// Level 2
-		{{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,  10 }},
-		// Level 3
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,  10 }},
-		// Level 4
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,  20 }},
-		// Level 5
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,  30 }},
-	};
-
-	// @brief b艮ɕKvȑf
-	const std::vector<CItem::Material> BlackSmith[CBuildObject::MAX_BUILD_LEVEL] =
-	{
-		// Level 1(z)
-		{{ CItem::ITEM_TYPE::Wood,  40 },{ CItem::ITEM_TYPE::Stone,   40 },{ CItem::ITEM_TYPE::Iron, 10 }},
-		// Level 2
-		{{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,   20 },{ CItem::ITEM_TYPE::Iron, 10 }},
-		// Level 3
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 },{ CItem::ITEM_TYPE::Iron, 15 }},
-		// Level 4
-		{{ CItem::ITEM_TYPE::Wood,  40 },{ CItem::ITEM_TYPE::Stone,   40 },{ CItem::ITEM_TYPE::Iron, 20 }},
-		// Level 5
-		{{ CItem::ITEM_TYPE::Wood,  50 },{ CItem::ITEM_TYPE::Stone,   50 },{ CItem::ITEM_TYPE::Iron, 25 }},
-	};
-
-	// @brief HiH{݂ɕKvȑf
-	const std::vector<CItem::Material> FoodFactory[CBuildObject::MAX_BUILD_LEVEL] =
-	{
-		// Level 1(z)
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 }},
-		// Level 2
-		{{ CItem::ITEM_TYPE::Wood,  15 },{ CItem::ITEM_TYPE::Stone,   15 }},
-		// Level 3
-		{{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,   20 }},
-		// Level 4
-		{{ CItem::ITEM_TYPE::Wood,  25 },{ CItem::ITEM_TYPE::Stone,   25 }},
-		// Level 5
-		{{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 }},
-	};
-
-	// @brief _{݂ɕKvȑf
-	const std::vector<CItem::Material> FarmFacility[CBuildObject::MAX_BUILD_LEVEL] =
+	// @brief z̑fރe[uiz^Cv~zxňj
+	constexpr MaterialTable::BuildRecipeTable DEFAULT_TABLE = []()
 	{
-		// Level 1(z)
-		{{ CItem::ITEM_TYPE::Stone,   20 },{ CItem::ITEM_TYPE::Fiber, 10 }},
-		// Level 2
-		{{ CItem::ITEM_TYPE::Stone,   10 },{ CItem::ITEM_TYPE::Fiber, 5 }},
-		// Level 3
-		{{ CItem::ITEM_TYPE::Stone,   15 },{ CItem::ITEM_TYPE::Fiber, 10 }},
-		// Level 4
-		{{ CItem::ITEM_TYPE::Stone,   20 },{ CItem::ITEM_TYPE::Fiber, 15 }},
-		// Level 5
-		{{ CItem::ITEM_TYPE::Stone,   25 },{ CItem::ITEM_TYPE::Fiber, 20 }},
-	};
+		using MaterialTable::MakeRecipe;
+		MaterialTable::BuildRecipeTable table{};
+
+		// xeɕKvȑf
+		table[MaterialTable::Index(CBuildManager::BuildType::RefreshFacility)] =
+		{
+			// Level 1(z)
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 }}),
+			// Level 2
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  10 },{ CItem::ITEM_TYPE::Stone,   10 }}),
+			// Level 3
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  15 },{ CItem::ITEM_TYPE::Stone,   15 }}),
+			// Level 4
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,   20 }}),
+			// Level 5
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  25 },{ CItem::ITEM_TYPE::Stone,   25 }}),
+		};
+
+		// lԂ̉ƂɕKvȑf
+		table[MaterialTable::Index(CBuildManager::BuildType::HumanHouse)] =
+		{
+			// Level 1(z)
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  50 },{ CItem::ITEM_TYPE::Stone,   20 }}),
+			// Level 2
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,  10 }}),
+			// Level 3
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,  10 }}),
+			// Level 4
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,  20 }}),
+			// Level 5
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,  30 }}),
+		};
+
+		// b艮ɕKvȑf
+		table[MaterialTable::Index(CBuildManager::BuildType::BlackSmith)] =
+		{
+			// Level 1(z)
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  40 },{ CItem::ITEM_TYPE::Stone,   40 },{ CItem::ITEM_TYPE::Iron, 10 }}),
+			// Level 2
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,   20 },{ CItem::ITEM_TYPE::Iron, 10 }}),
+			// Level 3
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 },{ CItem::ITEM_TYPE::Iron, 15 }}),
+			// Level 4
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  40 },{ CItem::ITEM_TYPE::Stone,   40 },{ CItem::ITEM_TYPE::Iron, 20 }}),
+			// Level 5
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  50 },{ CItem::ITEM_TYPE::Stone,   50 },{ CItem::ITEM_TYPE::Iron, 25 }}),
+		};
+
+		// HiH{݂ɕKvȑf
+		table[MaterialTable::Index(CBuildManager::BuildType::FoodFactory)] =
+		{
+			// Level 1(z)
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 }}),
+			// Level 2
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  15 },{ CItem::ITEM_TYPE::Stone,   15 }}),
+			// Level 3
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  20 },{ CItem::ITEM_TYPE::Stone,   20 }}),
+			// Level 4
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  25 },{ CItem::ITEM_TYPE::Stone,   25 }}),
+			// Level 5
+			MakeRecipe({{ CItem::ITEM_TYPE::Wood,  30 },{ CItem::ITEM_TYPE::Stone,   30 }}),
+		};
+
+		// _{݂ɕKvȑf
+		table[MaterialTable::Index(CBuildManager::BuildType::FarmFacility)] =
+		{
+			// Level 1(z)
+			MakeRecipe({{ CItem::ITEM_TYPE::Stone,   20 },{ CItem::ITEM_TYPE::Fiber, 10 }}),
+			// Level 2
+			MakeRecipe({{ CItem::ITEM_TYPE::Stone,   10 },{ CItem::ITEM_TYPE::Fiber, 5 }}),
+			// Level 3
+			MakeRecipe({{ CItem::ITEM_TYPE::Stone,   15 },{ CItem::ITEM_TYPE::Fiber, 10 }}),
+			// Level 4
+			MakeRecipe({{ CItem::ITEM_TYPE::Stone,   20 },{ CItem::ITEM_TYPE::Fiber, 15 }}),
+			// Level 5
+			MakeRecipe({{ CItem::ITEM_TYPE::Stone,   25 },{ CItem::ITEM_TYPE::Fiber, 20 }}),
+		};
+
+		return table;
+	}();
+
+	// SĂ̌z^Cv~zxɃVso^Ă邩
+	static_assert(MaterialTable::HasAllBuildEntries(DEFAULT_TABLE), "zfރe[uɖo^̌z^CvA܂͌zx܂");
 
 	// @brief w肳ꂽz^Cv̌zfރXg擾
-	std::vector<CItem::Material> GetBuildMaterials(CBuildManager::BuildType eType, int nLevel);
+	// @note e[uւ̎QƂԂߊmۂ͔Ȃ
+	CItem::MaterialSpan GetBuildMaterials(CBuildManager::BuildType eType, int nLevel);
 }
 
 // @brief fރf[^O
 namespace CookMaterials
 {
-	// @brief ̑fރXg
-	const std::vector<CItem::Material> Sugar = {
-		{ CItem::ITEM_TYPE::Apple,  1 }
-	};
-
-	// @brief AbvpC̑fރXg
-	const std::vector<CItem::Material> ApplePie = {
-		{ CItem::ITEM_TYPE::Apple,  2 },
-		{ CItem::ITEM_TYPE::Sugar,  1 }
-	};
-
-	// @brief p̑fރXg
-	const std::vector<CItem::Material> Bread = {
-		{ CItem::ITEM_TYPE::Wheat,  3 }
-	};
+	// @brief ̑fރe[uiACe^CvňAȊO͋j
+	constexpr MaterialTable::ItemRecipeTable DEFAULT_TABLE = []()
+	{
+		MaterialTable::ItemRecipeTable table{};
+
+		// 
+		table[MaterialTable::Index(CItem::ITEM_TYPE::Sugar)] = MaterialTable::MakeRecipe({
+			{ CItem::ITEM_TYPE::Apple,  1 } });
+
+		// AbvpC
+		table[MaterialTable::Index(CItem::ITEM_TYPE::ApplePie)] = MaterialTable::MakeRecipe({
+			{ CItem::ITEM_TYPE::Apple,  2 },
+			{ CItem::ITEM_TYPE::Sugar,  1 } });
+
+		// p
+		table[MaterialTable::Index(CItem::ITEM_TYPE::Bread)] = MaterialTable::MakeRecipe({
+			{ CItem::ITEM_TYPE::Wheat,  3 } });
+
+		return table;
+	}();
+
+	// SĂ̒ςݐHiƍɃVso^Ă邩
+	static_assert(MaterialTable::HasEntryForCategory(DEFAULT_TABLE, CItem::ITEM_CATEGORY::CookedFood), "fރe[uɖo^̗܂");
+	static_assert(!DEFAULT_TABLE[MaterialTable::Index(CItem::ITEM_TYPE::Sugar)].empty(), "̒fނo^ł");
 
 	// @brief w肳ꂽH^Cv̑fރXg擾
-	std::vector<CItem::Material> GetCookMaterials(CItem::ITEM_TYPE eType);
+	// @note e[uւ̎QƂԂߊmۂ͔Ȃ
+	CItem::MaterialSpan GetCookMaterials(CItem::ITEM_TYPE eType);
 
 	// @brief w肳ꂽH^Cv̊iACeXg擾
 	std::vector<CItem*> GetFinishedMealItems(CItem::ITEM_TYPE eType);
@@ -147,4 +255,4 @@ namespace CropMaterials
 {
 	// @brief w肳ꂽ^Cv̊앨Xg擾
 	CItem::ITEM_TYPE GetCropFromSeed(CItem::ITEM_TYPE eType);
-}
\ No newline at end of file
+}
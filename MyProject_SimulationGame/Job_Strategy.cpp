@@ -10,7 +10,7 @@
 #include "StructMath.h"
 #include "Oparation.h"
 #include "RefreshFacility.h"
-#include "BuildManager.h"
+#include "RestSlotAllocator.h"
 #include "ImguiSystem.h"
 
 /*****************************************//*
@@ -18,11 +18,10 @@
 *//*****************************************/
 IJob_Strategy::~IJob_Strategy()
 {
-	// xe{݂gpĂꍇ
-	if (m_UsingRefreshFacility != nullptr)
+	// xe{݂̘g蓖ĂĂꍇ͉i҂sɕłꍇ͗񂩂甲j
+	if (m_pOwner != nullptr)
 	{
-		// xe{݂̎gp
-		m_UsingRefreshFacility->ReleaseRefreshFacility(*m_pOwner);
+		CRestSlotAllocator::GetInstance()->Release(m_pOwner);
 	}
 }
 
@@ -38,70 +37,51 @@ void IJob_Strategy::SetOwner(CHuman& pOwner)
 	m_pOwner->GetSkill()->ApplySkillBuff(m_fWorkPower, this);
 }
 
+/*****************************************//*
+	@brief@	| d̒f
+	@note		| xerŎd𗣂ꂽꍇgcȂ悤ɉ
+*//*****************************************/
+void IJob_Strategy::OnStopWork()
+{
+	ReleaseRestSlot();
+}
+
 /*****************************************//*
 	@brief@	| xe
 *//*****************************************/
 bool IJob_Strategy::RestAction()
 {
+	CRestSlotAllocator* pAllocator = CRestSlotAllocator::GetInstance();
+
 	// X^~iő̏ꍇ͋xe
 	if(m_pOwner->IsMaxStamina())
 	{
+		// {݈ȊOŉ񕜂ꍇg
+		ReleaseRestSlot();
 		return true;
 	}
 
-	// Oxe{IDXg
-	std::vector<ObjectID> vNotRefreshFacilityIDs;
-
-	// xe{݂܂gpĂȂꍇ
-	while (m_UsingRefreshFacility == nullptr)
-	{
-		// xe{݂T[v
-		m_UsingRefreshFacility = GetScene()->GetGameObject<CRefreshFacility>(m_pOwner->GetPos(), vNotRefreshFacilityIDs);
-
-		// xe{݂Ȃꍇ
-		if (m_UsingRefreshFacility == nullptr)
-		{
-			// zǗVXeɋxe{݂̌zNGXg𑗂
-			CBuildManager::GetInstance()->AddBuildRequest(CBuildManager::BuildType::RefreshFacility);
-
-			// xe{݂Ȃꍇ͏𔲂
-			return false;
-		}
-
-		// xe{݂gp\ǂmF
-		if (!m_UsingRefreshFacility->CanUseRefreshFacility())
-		{
-			// gps̏ꍇ́AOXgɒǉčēxT
-			vNotRefreshFacilityIDs.push_back(m_UsingRefreshFacility->GetID());
-			m_UsingRefreshFacility = nullptr;
-		}
-		else break;
-	}
+	// xe{݂̘gvi蓖čς݂Ȃ瓯{݂Ԃ̂Ŗt[͔̌Ȃj
+	m_UsingRefreshFacility = pAllocator->Request(m_pOwner);
 
 	if(m_UsingRefreshFacility == nullptr)
 	{
-		// xe{݂Ȃꍇ͋xełȂ̂falseԂ
+		// xe{݂1ꍇ͌z܂ŋxełȂ̂falseԂ
 		return false;
 	}
 
 	// xe{݂ֈړ
 	if (m_pOwner->MoveToTarget(m_UsingRefreshFacility, Human_Move_Speed))
 	{
+		// ҂sɕłꍇ͎{݂̑OŏԂ҂
+		if (!pAllocator->IsGranted(m_pOwner))
+		{
+			return false;
+		}
 
-		// xe{݂gpĂȂꍇ̏
+		// xe{݂gpĂȂꍇ͎gp
 		if (!m_UsingRefreshFacility->IsUsingRefreshFacility(*m_pOwner))
 		{
-			// xe{݂gp\ǂmF
-			if (!m_UsingRefreshFacility->CanUseRefreshFacility())
-			{
-				// zǗVXeɋxe{݂̌zNGXg𑗂
-				CBuildManager::GetInstance()->AddBuildRequest(CBuildManager::BuildType::RefreshFacility);
-
-				// xe{݂gps̏ꍇ͋xełȂ̂falseԂ
-				return false;
-			}
-
-			// xe{݂gp
 			m_UsingRefreshFacility->UseRefreshFacility(*m_pOwner);
 		}
 
@@ -111,10 +91,8 @@ bool IJob_Strategy::RestAction()
 		// xetrueԂ
 		if (m_pOwner->IsMaxStamina())
 		{
-			// xe{݂̎gp
-			m_UsingRefreshFacility->ReleaseRefreshFacility(*m_pOwner);
-			// xe{IDZbg
-			m_UsingRefreshFacility = nullptr;
+			// xe{݂̘gi҂ĂlԂɊ蓖Ăj
+			ReleaseRestSlot();
 			return true;
 		}
 	}
@@ -123,6 +101,17 @@ bool IJob_Strategy::RestAction()
 	return false;
 }
 
+/*****************************************//*
+	@brief@	| xe{݂̘g
+*//*****************************************/
+void IJob_Strategy::ReleaseRestSlot()
+{
+	if (m_pOwner == nullptr) return;
+
+	CRestSlotAllocator::GetInstance()->Release(m_pOwner);
+	m_UsingRefreshFacility = nullptr;
+}
+
 /*****************************************//*
 	@brief@	| EƃXe[^XImGui`揈
 *//*****************************************/
@@ -38,6 +38,11 @@ public:
 	// @brief EƂƂ̐؂ւ̏z֐
 	virtual void OnChangeJob() = 0;
 
+	// @brief xeEHEEƕύXESȂǂŎd𒆒f̏
+	// @note xe{݂̘g
+	//       dɂێ˗Ȃǂꍇ̓I[o[ChĎ
+	virtual void OnStopWork();
+
 	// @brief EƖ擾鏃z֐
 	// @return EƖ̕
 	virtual std::string GetJobName() const = 0;
@@ -61,6 +66,10 @@ protected:
 	// @return true:xe false:xe
 	bool RestAction();
 
+	// @brief xe{݂̘g
+	// @note ҂sɕłꍇ͗񂩂甲
+	void ReleaseRestSlot();
+
 protected:
 	// @brief ĂIuWFNg̃|C^
 	CHuman* m_pOwner = nullptr;
@@ -12,6 +12,8 @@
 #include "ObjectLoad.h"
 #include "ImguiSystem.h"
 #include "ShaderManager.h"
+#include "Item_Material.h"
+#include "Random.h"
 
 
 // 現在のシーンポインタ
@@ -50,7 +52,8 @@ HRESULT Init(HWND hWnd, UINT width, UINT height)
 	if (FAILED(hr)) { return hr; }
 	g_hWnd = hWnd;
 
-	srand(timeGetTime());
+	// 地形生成時に地形のシードで設定し直す
+	Random::SetWorldSeed(timeGetTime());
 
 	// Imgui初期化
 	CImguiSystem::GetInstance()->Init();
@@ -58,6 +61,9 @@ HRESULT Init(HWND hWnd, UINT width, UINT height)
 	// オブジェクトのロード
 	CObjectLoad::LoadAll();
 
+	// 素材テーブルの上書き読み込み（ファイルが無い場合は既定値を使用）
+	MaterialTable::LoadOverrides(DATA_PATH("MaterialOverride.json"));
+
 	// ジオメトリ初期化
 	Geometory::Init();
 
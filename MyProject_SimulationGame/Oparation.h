@@ -1,12 +1,11 @@
 #pragma once
 #include <DirectXMath.h>
+#include "Random.h"
 
+// 範囲内の整数の乱数取得（inMax は含まない、メインスレッド専用）
 inline int GetRandOfRange(const int inMin, const int inMax)
 {
-    int out = rand() % (inMax - inMin);
-    out += inMin;
-
-    return out;
+    return Random::Global().Range(inMin, inMax);
 }
 
 // FLOAT2同士の演算子オーバーロード
@@ -0,0 +1,264 @@
+/**************************************************//*
+	@file	| ProductionManager.cpp
+	@brief	| YisǗVXecppt@C
+	@note	| YƂɊJnt[ƐisxێA
+			| isx͕KvȎɌvZA͗\t[̍ŏq[vŒʒm
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "ProductionManager.h"
+#include <algorithm>
+#include <cmath>
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CProductionManager::CProductionManager()
+	: m_nCurrentTick(0)
+	, m_nNextScheduleId(0)
+	, m_fBaseProgress()
+	, m_nBaseTick()
+	, m_fRate()
+	, m_nScheduleIds()
+	, m_pOwners()
+	, m_nUserData()
+	, m_nHandles()
+	, m_nHandleToIndex()
+	, m_nFreeHandles()
+	, m_CompletionHeap()
+	, m_CompletedEvents()
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CProductionManager::~CProductionManager()
+{
+}
+
+/*****************************************//*
+	@brief@	| XV
+	@param		| nElapsedTickFi߂t[
+	@note		| Ył\Ô̂ɂ͈ؐGȂ
+				| ʒm͔zlߏIĂsAʒm̒ǉE폜ɔ
+*//*****************************************/
+void CProductionManager::Update(uint64_t nElapsedTick)
+{
+	m_nCurrentTick += nElapsedTick;
+
+	// \t[}Yoi莞\菇Ɏoj
+	m_CompletedEvents.clear();
+	while (!m_CompletionHeap.empty() && m_CompletionHeap.front().nCompleteTick <= m_nCurrentTick)
+	{
+		std::pop_heap(m_CompletionHeap.begin(), m_CompletionHeap.end(), IsLaterCompletion);
+		ScheduledCompletion completion = m_CompletionHeap.back();
+		m_CompletionHeap.pop_back();
+
+		// 폜ς݁A܂͑xύXŌÂȂ\͓ǂݎ̂Ă
+		int nIndex = m_nHandleToIndex[completion.nHandle];
+		if (nIndex == INVALID_HANDLE || m_nScheduleIds[nIndex] != completion.nScheduleId) continue;
+
+		m_CompletedEvents.push_back({ m_pOwners[nIndex], m_nHandles[nIndex], m_nUserData[nIndex] });
+		RemoveAt(nIndex);
+	}
+
+	// ʒmiʒmɔjꂽ{݂͏Oς݁j
+	for (const CompletedEvent& event : m_CompletedEvents)
+	{
+		if (event.pOwner == nullptr) continue;
+		event.pOwner->OnProductionCompleted(event.nHandle, event.nUserData);
+	}
+}
+
+/*****************************************//*
+	@brief@	| Y̒ǉ
+	@param		| pOwnerFʒm{
+	@param		| fRateF1t[̐isx
+	@param		| nUserDataFʒmɕԂl
+	@return		| Ỹnh
+*//*****************************************/
+int CProductionManager::AddProduction(IProductionListener* pOwner, float fRate, int nUserData)
+{
+	if (pOwner == nullptr) return INVALID_HANDLE;
+
+	// nh̊蓖āi󂫂΍ėpj
+	int nHandle;
+	if (!m_nFreeHandles.empty())
+	{
+		nHandle = m_nFreeHandles.back();
+		m_nFreeHandles.pop_back();
+	}
+	else
+	{
+		nHandle = static_cast<int>(m_nHandleToIndex.size());
+		m_nHandleToIndex.push_back(INVALID_HANDLE);
+	}
+
+	// ɒǉ
+	size_t nIndex = m_fBaseProgress.size();
+	m_nHandleToIndex[nHandle] = static_cast<int>(nIndex);
+	m_fBaseProgress.push_back(0.0f);
+	m_nBaseTick.push_back(m_nCurrentTick);
+	m_fRate.push_back(fRate);
+	m_nScheduleIds.push_back(0);
+	m_pOwners.push_back(pOwner);
+	m_nUserData.push_back(nUserData);
+	m_nHandles.push_back(nHandle);
+
+	// \o^
+	ScheduleCompletion(nIndex);
+
+	return nHandle;
+}
+
+/*****************************************//*
+	@brief@	| w肵{݂̐YSč폜
+	@param		| pOwnerF{
+	@note		| q[vɎc\͎oɓǂݎ̂Ă
+*//*****************************************/
+void CProductionManager::RemoveProductions(IProductionListener* pOwner)
+{
+	for (size_t i = m_pOwners.size(); i-- > 0;)
+	{
+		if (m_pOwners[i] == pOwner) RemoveAt(i);
+	}
+
+	// ʒm҂̃CxgO
+	for (CompletedEvent& event : m_CompletedEvents)
+	{
+		if (event.pOwner == pOwner) event.pOwner = nullptr;
+	}
+}
+
+/*****************************************//*
+	@brief@	| w肵{݂̐Y̐isxύX
+	@param		| pOwnerF{
+	@param		| fRateF1t[̐isx
+*//*****************************************/
+void CProductionManager::SetRate(IProductionListener* pOwner, float fRate)
+{
+	for (size_t i = 0; i < m_pOwners.size(); ++i)
+	{
+		if (m_pOwners[i] != pOwner || m_fRate[i] == fRate) continue;
+
+		// ݂̐isxɂĂ瑬xύX
+		m_fBaseProgress[i] = CalcProgress(i);
+		m_nBaseTick[i] = m_nCurrentTick;
+		m_fRate[i] = fRate;
+		ScheduleCompletion(i);
+	}
+}
+
+/*****************************************//*
+	@brief@	| Y̐isx擾
+	@param		| nHandleFỸnh
+	@return		| isxAȃnh̏ꍇ0
+*//*****************************************/
+float CProductionManager::GetProgress(int nHandle) const
+{
+	if (nHandle < 0 || nHandle >= static_cast<int>(m_nHandleToIndex.size())) return 0.0f;
+
+	int nIndex = m_nHandleToIndex[nHandle];
+	if (nIndex == INVALID_HANDLE) return 0.0f;
+
+	return CalcProgress(nIndex);
+}
+
+/*****************************************//*
+	@brief@	| Y̊\t[擾
+	@param		| nHandleFỸnh
+	@return		| \t[Aȃnh̏ꍇNEVER_COMPLETE_TICK
+*//*****************************************/
+uint64_t CProductionManager::GetCompleteTick(int nHandle) const
+{
+	if (nHandle < 0 || nHandle >= static_cast<int>(m_nHandleToIndex.size())) return NEVER_COMPLETE_TICK;
+
+	int nIndex = m_nHandleToIndex[nHandle];
+	if (nIndex == INVALID_HANDLE || m_fRate[nIndex] <= 0.0f) return NEVER_COMPLETE_TICK;
+
+	// t[ZĂƓAisxɓ͂ŏ̃t[
+	float fRemaining = PRODUCTION_COMPLETE_PROGRESS - m_fBaseProgress[nIndex];
+	uint64_t nWaitTick = 0;
+	if (fRemaining > 0.0f)
+	{
+		nWaitTick = static_cast<uint64_t>(std::ceil(fRemaining / m_fRate[nIndex] - 0.001f));
+	}
+	return m_nBaseTick[nIndex] + nWaitTick;
+}
+
+/*****************************************//*
+	@brief@	| q[v̔r֐
+	@param		| aFr銮\
+	@param		| bFr銮\
+	@return		| a̕bɊꍇtrue
+*//*****************************************/
+bool CProductionManager::IsLaterCompletion(const ScheduledCompletion& a, const ScheduledCompletion& b)
+{
+	if (a.nCompleteTick != b.nCompleteTick) return a.nCompleteTick > b.nCompleteTick;
+
+	// t[Ɋ̂͗\
+	return a.nScheduleId > b.nScheduleId;
+}
+
+/*****************************************//*
+	@brief@	| w肵ʒu̐Y̐isxvZ
+	@param		| nIndexFŸʒu
+	@return		| isxiisxœłj
+*//*****************************************/
+float CProductionManager::CalcProgress(size_t nIndex) const
+{
+	float fProgress = m_fBaseProgress[nIndex] + m_fRate[nIndex] * static_cast<float>(m_nCurrentTick - m_nBaseTick[nIndex]);
+	return std::min(fProgress, PRODUCTION_COMPLETE_PROGRESS);
+}
+
+/*****************************************//*
+	@brief@	| w肵ʒu̐Y̊\o^
+	@param		| nIndexFŸʒu
+	@note		| ȑO̗\͗\ԍς邽ߖɂȂ
+*//*****************************************/
+void CProductionManager::ScheduleCompletion(size_t nIndex)
+{
+	m_nScheduleIds[nIndex] = m_nNextScheduleId++;
+
+	// isȂY͗\񂵂Ȃ
+	uint64_t nCompleteTick = GetCompleteTick(m_nHandles[nIndex]);
+	if (nCompleteTick == NEVER_COMPLETE_TICK) return;
+
+	m_CompletionHeap.push_back({ nCompleteTick, m_nScheduleIds[nIndex], m_nHandles[nIndex] });
+	std::push_heap(m_CompletionHeap.begin(), m_CompletionHeap.end(), IsLaterCompletion);
+}
+
+/*****************************************//*
+	@brief@	| w肵ʒu̐Y폜
+	@param		| nIndexF폜ʒu
+	@note		| ̗vf폜ʒuֈړċl߂
+*//*****************************************/
+void CProductionManager::RemoveAt(size_t nIndex)
+{
+	size_t nLast = m_fBaseProgress.size() - 1;
+
+	// nh
+	m_nHandleToIndex[m_nHandles[nIndex]] = INVALID_HANDLE;
+	m_nFreeHandles.push_back(m_nHandles[nIndex]);
+
+	// ̗vfړ
+	if (nIndex != nLast)
+	{
+		m_fBaseProgress[nIndex] = m_fBaseProgress[nLast];
+		m_nBaseTick[nIndex] = m_nBaseTick[nLast];
+		m_fRate[nIndex] = m_fRate[nLast];
+		m_nScheduleIds[nIndex] = m_nScheduleIds[nLast];
+		m_pOwners[nIndex] = m_pOwners[nLast];
+		m_nUserData[nIndex] = m_nUserData[nLast];
+		m_nHandles[nIndex] = m_nHandles[nLast];
+		m_nHandleToIndex[m_nHandles[nIndex]] = static_cast<int>(nIndex);
+	}
+
+	m_fBaseProgress.pop_back();
+	m_nBaseTick.pop_back();
+	m_fRate.pop_back();
+	m_nScheduleIds.pop_back();
+	m_pOwners.pop_back();
+	m_nUserData.pop_back();
+	m_nHandles.pop_back();
+}
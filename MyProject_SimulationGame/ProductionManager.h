@@ -0,0 +1,160 @@
+/**************************************************//*
+	@file	| ProductionManager.h
+	@brief	| YisǗVXeht@C
+	@note	| YƂɊJnt[ƐisxێA
+			| isx͕KvȎɌvZA͗\t[̍ŏq[vŒʒm
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include <vector>
+#include <cstdint>
+
+// @brief Y̒ʒm󂯎C^[tF[X
+class IProductionListener
+{
+public:
+	// @brief zfXgN^
+	virtual ~IProductionListener() = default;
+
+	// @brief Y̒ʒm
+	// @param nHandleFỸnhiʒm͖j
+	// @param nUserDataFYǉɓnl
+	virtual void OnProductionCompleted(int nHandle, int nUserData) = 0;
+};
+
+// @brief YisǗVXeNX
+class CProductionManager : public ISingleton<CProductionManager>
+{
+public:
+	// @brief Yisx
+	static constexpr float PRODUCTION_COMPLETE_PROGRESS = 100.0f;
+
+	// @brief ȃnh
+	static constexpr int INVALID_HANDLE = -1;
+
+	// @brief ȂY̊\t[
+	static constexpr uint64_t NEVER_COMPLETE_TICK = UINT64_MAX;
+
+private:
+	// @brief RXgN^
+	CProductionManager();
+
+	friend class ISingleton<CProductionManager>;
+
+public:
+	// @brief fXgN^
+	~CProductionManager();
+
+	// @brief XV
+	// @param nElapsedTickFi߂t[i莞͕t[܂Ƃ߂Đi߂j
+	// @note \t[}YoĒʒm
+	void Update(uint64_t nElapsedTick = 1);
+
+	// @brief Y̒ǉ
+	// @param pOwnerFʒm{
+	// @param fRateF1t[̐isx
+	// @param nUserDataFʒmɕԂli앨̃ACe^Cvj
+	// @return Ỹnh
+	int AddProduction(IProductionListener* pOwner, float fRate, int nUserData);
+
+	// @brief w肵{݂̐YSč폜
+	// @param pOwnerF{
+	void RemoveProductions(IProductionListener* pOwner);
+
+	// @brief w肵{݂̐Y̐isxύX
+	// @param pOwnerF{
+	// @param fRateF1t[̐isx
+	// @note ύX_̐isxɂĊ\t[vZ
+	void SetRate(IProductionListener* pOwner, float fRate);
+
+	// @brief Y̐isx擾
+	// @param nHandleFỸnh
+	// @return isxAȃnh̏ꍇ0
+	float GetProgress(int nHandle) const;
+
+	// @brief Y̊\t[擾
+	// @param nHandleFỸnh
+	// @return \t[Aȃnh̏ꍇNEVER_COMPLETE_TICK
+	uint64_t GetCompleteTick(int nHandle) const;
+
+	// @brief ݂̃t[擾
+	uint64_t GetCurrentTick() const { return m_nCurrentTick; }
+
+	// @brief is̐Y擾
+	size_t GetProductionCount() const { return m_fBaseProgress.size(); }
+
+private:
+	// @brief \\
+	struct ScheduledCompletion
+	{
+		uint64_t nCompleteTick;	// \t[
+		uint64_t nScheduleId;	// \ԍixύX폜ŌÂȂ\̔pj
+		int nHandle;			// nh
+	};
+
+	// @brief ʒm\
+	struct CompletedEvent
+	{
+		IProductionListener* pOwner;	// ʒm
+		int nHandle;					// nh
+		int nUserData;					// ǉɓnꂽl
+	};
+
+	// @brief q[v̔r֐i\肪x̂ɂj
+	static bool IsLaterCompletion(const ScheduledCompletion& a, const ScheduledCompletion& b);
+
+	// @brief w肵ʒu̐Y̐isxvZ
+	// @param nIndexFŸʒu
+	float CalcProgress(size_t nIndex) const;
+
+	// @brief w肵ʒu̐Y̊\o^
+	// @param nIndexFŸʒu
+	void ScheduleCompletion(size_t nIndex);
+
+	// @brief w肵ʒu̐Y폜iƓւċl߂j
+	// @param nIndexF폜ʒu
+	void RemoveAt(size_t nIndex);
+
+private:
+	// @brief ݂̃t[
+	uint64_t m_nCurrentTick;
+
+	// @brief Ɋ蓖Ă\ԍ
+	uint64_t m_nNextScheduleId;
+
+	// ȉ͓ʒu̗vf̐Y\i\̂̔zł͂Ȃz̍\́j
+
+	// @brief t[_̐isx
+	std::vector<float> m_fBaseProgress;
+
+	// @brief isx̊t[iJn܂͑xύXt[j
+	std::vector<uint64_t> m_nBaseTick;
+
+	// @brief 1t[̐isx
+	std::vector<float> m_fRate;
+
+	// @brief Lȗ\ԍ
+	std::vector<uint64_t> m_nScheduleIds;
+
+	// @brief ʒm{
+	std::vector<IProductionListener*> m_pOwners;
+
+	// @brief ǉɓnꂽl
+	std::vector<int> m_nUserData;
+
+	// @brief nh
+	std::vector<int> m_nHandles;
+
+	// @brief nhz̈ʒuւ̕ϊ\igpINVALID_HANDLEj
+	std::vector<int> m_nHandleToIndex;
+
+	// @brief ėpłnh
+	std::vector<int> m_nFreeHandles;
+
+	// @brief \̍ŏq[viÂȂ\͎oɓǂݎ̂Ăj
+	std::vector<ScheduledCompletion> m_CompletionHeap;
+
+	// @brief ʒm̈ꎞobt@it[̊mۂ邽ߕێj
+	std::vector<CompletedEvent> m_CompletedEvents;
+};
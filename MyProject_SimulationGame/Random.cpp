@@ -0,0 +1,170 @@
+/**************************************************//*
+	@file	| Random.cpp
+	@brief	| JE^x[X̗cppt@C
+	@note	| ([hV[h, Xg[, eBbN, 擾)痐𒼐ڌvZ
+			| ԂLȂ̂ŁA[J[XbhbNŎg
+			| V[hȂXbhXVɊ֌WȂʂɂȂ
+*//**************************************************/
+#include "Random.h"
+
+namespace
+{
+	// @brief [hV[h
+	uint32_t g_uWorldSeed = 0;
+
+	// @brief ݂̃eBbNiCXbhށj
+	uint32_t g_uTick = 0;
+
+	/*****************************************//*
+		@brief@	| 64rbg̍֐iSplitMix64̍ŏIij
+		@param		| zF͒l
+		@return		| Srbg͂̑SrbgɈˑl
+	*//*****************************************/
+	uint64_t Mix64(uint64_t z)
+	{
+		z += 0x9E3779B97F4A7C15ull;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	/*****************************************//*
+		@brief@	| ނƌ̔ԍXg[̍쐬
+		@param		| eKindFXg[̎
+		@param		| uEntityF̔ԍ
+		@return		| Xg[
+	*//*****************************************/
+	uint64_t MakeStream(Random::StreamKind eKind, uint32_t uEntity)
+	{
+		return (static_cast<uint64_t>(eKind) << 32) | uEntity;
+	}
+}
+
+/*****************************************//*
+	@brief@	| [hV[h̐ݒ
+	@param		| uSeedF[hV[h
+*//*****************************************/
+void Random::SetWorldSeed(uint32_t uSeed)
+{
+	g_uWorldSeed = uSeed;
+	g_uTick = 0;
+}
+
+/*****************************************//*
+	@brief@	| [hV[h̎擾
+	@return		| [hV[h
+*//*****************************************/
+uint32_t Random::GetWorldSeed()
+{
+	return g_uWorldSeed;
+}
+
+/*****************************************//*
+	@brief@	| eBbNi߂
+*//*****************************************/
+void Random::AdvanceTick()
+{
+	g_uTick++;
+}
+
+/*****************************************//*
+	@brief@	| ݂̃eBbN̎擾
+	@return		| ݂̃eBbN
+*//*****************************************/
+uint32_t Random::GetTick()
+{
+	return g_uTick;
+}
+
+/*****************************************//*
+	@brief@	| Ǝ擾񐔂痐̌vZ
+	@param		| uSeedF[hV[h
+	@param		| uStreamFXg[iނƌ̔ԍj
+	@param		| uTickFeBbN
+	@param		| uCounterFeBbN̎擾
+	@return		| 32rbg̗
+*//*****************************************/
+uint32_t Random::Generate(uint32_t uSeed, uint64_t uStream, uint32_t uTick, uint32_t uCounter)
+{
+	// iV[hƃXg[jĂAJE^ieBbNƎ擾񐔁j
+	const uint64_t uKey = Mix64(Mix64(uSeed) ^ uStream);
+	const uint64_t uCount = (static_cast<uint64_t>(uTick) << 32) | uCounter;
+	return static_cast<uint32_t>(Mix64(uKey ^ Mix64(uCount)) >> 32);
+}
+
+/*****************************************//*
+	@brief@	| RXgN^
+	@param		| eKindFXg[̎
+	@param		| uEntityF̔ԍ
+*//*****************************************/
+Random::CStream::CStream(StreamKind eKind, uint32_t uEntity)
+	: m_eKind(eKind)
+	, m_uStream(MakeStream(eKind, uEntity))
+	, m_uTick(0)
+	, m_uCounter(0)
+	, m_uSeed(0)
+{
+}
+
+/*****************************************//*
+	@brief@	| ̔ԍ̐ݒ
+	@param		| uEntityF̔ԍ
+*//*****************************************/
+void Random::CStream::SetEntity(uint32_t uEntity)
+{
+	m_uStream = MakeStream(m_eKind, uEntity);
+	m_uCounter = 0;
+}
+
+/*****************************************//*
+	@brief@	| 32rbg̗擾
+	@return		| 32rbg̗
+	@note		| eBbNV[hς擾񐔂0琔̂ŁA
+				| ʂ(V[h, Xg[, eBbN, ̃eBbNŉڂ)Ō܂
+*//*****************************************/
+uint32_t Random::CStream::NextUInt()
+{
+	if (m_uTick != g_uTick || m_uSeed != g_uWorldSeed)
+	{
+		m_uTick = g_uTick;
+		m_uSeed = g_uWorldSeed;
+		m_uCounter = 0;
+	}
+
+	return Generate(m_uSeed, m_uStream, m_uTick, m_uCounter++);
+}
+
+/*****************************************//*
+	@brief@	| 0..1̗擾
+	@return		| (0.0f`1.0f)
+*//*****************************************/
+float Random::CStream::Next01()
+{
+	// 24rbggp0.0f`1.0fɐK
+	return static_cast<float>(NextUInt() >> 8) / static_cast<float>(0x01000000);
+}
+
+/*****************************************//*
+	@brief@	| ͈͓̗̐擾
+	@param		| nMinFŏl
+	@param		| nMaxFőli܂܂Ȃj
+	@return		| (nMin`nMax)
+*//*****************************************/
+int Random::CStream::Range(int nMin, int nMax)
+{
+	if (nMax <= nMin) return nMin;
+
+	// 64rbg̏ZŔ͈͂Ɏʂi]ɂ΂ƏZj
+	const uint64_t uRange = static_cast<uint64_t>(static_cast<int64_t>(nMax) - nMin);
+	return nMin + static_cast<int>((static_cast<uint64_t>(NextUInt()) * uRange) >> 32);
+}
+
+/*****************************************//*
+	@brief@	| ėpXg[̎擾
+	@return		| ėpXg[
+*//*****************************************/
+Random::CStream& Random::Global()
+{
+	static CStream s_Stream(StreamKind::Global, 0);
+	return s_Stream;
+}
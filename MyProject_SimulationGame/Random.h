@@ -0,0 +1,95 @@
+/**************************************************//*
+	@file	| Random.h
+	@brief	| JE^x[X̗ht@C
+	@note	| ([hV[h, Xg[, eBbN, 擾)痐𒼐ڌvZ
+			| ԂLȂ̂ŁA[J[XbhbNŎg
+			| V[hȂXbhXVɊ֌WȂʂɂȂ
+*//**************************************************/
+#pragma once
+#include <cstdint>
+
+// JE^x[X̗̖O
+namespace Random
+{
+	// @brief Xg[̎ށiނƂɌ̔ԍ̋Ԃ𕪂j
+	enum class StreamKind : uint32_t
+	{
+		Global,			// ėpiCXbhpj
+		Territory,		// ꒣̐
+		FieldPlacement,	// ̔zu
+		BuildPosition,	// zʒǔ
+		Animal,			// ̌́i̔ԍ͋ԃObh̃nhj
+		Flock,			// Qi̔ԍ͌Q̔ԍj
+	};
+
+	// @brief [hV[h̐ݒ
+	// @param uSeedF[hV[h
+	// @note eBbN0ɖ߂
+	void SetWorldSeed(uint32_t uSeed);
+
+	// @brief [hV[h̎擾
+	uint32_t GetWorldSeed();
+
+	// @brief eBbNi߂
+	// @note CXbhŃt[̍ŏ1񂾂Ăяo
+	void AdvanceTick();
+
+	// @brief ݂̃eBbN̎擾
+	uint32_t GetTick();
+
+	// @brief Ǝ擾񐔂痐̌vZ
+	// @param uSeedF[hV[h
+	// @param uStreamFXg[iނƌ̔ԍj
+	// @param uTickFeBbN
+	// @param uCounterFeBbN̎擾
+	// @return 32rbg̗
+	uint32_t Generate(uint32_t uSeed, uint64_t uStream, uint32_t uTick, uint32_t uCounter);
+
+	// @brief Xg[NX
+	// @note ێ̂̓eBbN̎擾񐔂Ȃ̂ŁA̂ƂɎĂΕɎg
+	class CStream
+	{
+	public:
+		// @brief RXgN^
+		// @param eKindFXg[̎
+		// @param uEntityF̔ԍ
+		CStream(StreamKind eKind, uint32_t uEntity);
+
+		// @brief ̔ԍ̐ݒi擾񐔂0ɖ߂j
+		// @param uEntityF̔ԍ
+		void SetEntity(uint32_t uEntity);
+
+		// @brief 32rbg̗擾
+		uint32_t NextUInt();
+
+		// @brief 0..1̗擾
+		// @return (0.0f`1.0f)
+		float Next01();
+
+		// @brief ͈͓̗̐擾
+		// @param nMinFŏl
+		// @param nMaxFőli܂܂Ȃj
+		// @return (nMin`nMax)A͈͂ȂnMin
+		int Range(int nMin, int nMax);
+
+	private:
+		// @brief Xg[̎
+		StreamKind m_eKind;
+
+		// @brief Xg[iނƌ̔ԍj
+		uint64_t m_uStream;
+
+		// @brief ŌɎ擾eBbN
+		uint32_t m_uTick;
+
+		// @brief eBbN̎擾
+		uint32_t m_uCounter;
+
+		// @brief ŌɎ擾[hV[h
+		uint32_t m_uSeed;
+	};
+
+	// @brief ėpXg[̎擾
+	// @note CXbhpAɎgꍇ͌̂Ƃ̃Xg[
+	CStream& Global();
+}
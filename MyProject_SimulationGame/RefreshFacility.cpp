@@ -8,6 +8,7 @@
 #include "ModelRenderer.h"
 #include "ImguiSystem.h"
 #include "ShaderManager.h"
+#include "RestSlotAllocator.h"
 
 /*****************************************//*
 	@brief@	| RXgN^
@@ -22,6 +23,8 @@ CRefreshFacility::CRefreshFacility()
 *//*****************************************/
 CRefreshFacility::~CRefreshFacility()
 {
+	// g蓖ăVXeo^
+	CRestSlotAllocator::GetInstance()->RemoveFacility(this);
 }
 
 /*****************************************//*
@@ -45,6 +48,25 @@ void CRefreshFacility::Init()
 	// sNZVF[_[̐ݒ
 	pModelRenderer->SetPixelShader(pShaderManager->GetPixelShader(PSType::TexColor));
 
+	// g蓖ăVXeɓo^
+	m_nNotifiedBuildLevel = m_nBuildLevel;
+	CRestSlotAllocator::GetInstance()->AddFacility(this);
+}
+
+/*****************************************//*
+	@brief@	| XV
+*//*****************************************/
+void CRefreshFacility::Update()
+{
+	// NX̍XV
+	CBuildObject::Update();
+
+	// zxオgpłl̂Œʒm
+	if (m_nNotifiedBuildLevel != m_nBuildLevel)
+	{
+		m_nNotifiedBuildLevel = m_nBuildLevel;
+		CRestSlotAllocator::GetInstance()->OnCapacityChanged(this);
+	}
 }
 
 /*****************************************//*
@@ -42,6 +42,9 @@ public:
 	// @brief 
 	virtual void Init() override;
 
+	// @brief XV
+	virtual void Update() override;
+
 	// @brief CXyN^[\
 	virtual int Inspecter()override;
 
@@ -49,6 +52,9 @@ public:
 	// @return true:gp\ false:gps
 	bool CanUseRefreshFacility() const;
 
+	// @brief xe{݂gpłől̎擾
+	int GetCapacity() const { return MAX_USING_HUMANS[m_nBuildLevel - 1]; }
+
 	// @brief xe̎gp
 	void UseRefreshFacility(CHuman& pHuman);
 
@@ -62,5 +68,9 @@ public:
 	// @brief xe{݂gpĂlԂ̒ǉ
 	std::vector<CHuman*> m_pUsingHumans;
 
+private:
+	// @brief g蓖ăVXeɒʒmς݂̌zx
+	int m_nNotifiedBuildLevel = 0;
+
 };
 
@@ -0,0 +1,104 @@
+/**************************************************//*
+	@file	| RegrowthGenerator.cpp
+	@brief	| ĐWFl[^[NXcppt@C
+	@note	| ͊ZĐt[ƋɋL^A
+			| t[Ƃ̐܂ŏĐ
+			| IGeneratorp
+*//**************************************************/
+#include "Generator.h"
+#include "Main.h"
+#include "ImguiSystem.h"
+#include <cmath>
+
+/*****************************************
+	@brief@	| RXgN^
+	@param@	| eCellTypeFĐZ^Cv
+	@param@	| fRegrowTimeF͊ĂĐ܂ł̎ԁibj
+	@param@	| sResourceNameFifobOOpj
+*//*****************************************/
+CRegrowthGenerator::CRegrowthGenerator(CFieldCell::CellType eCellType, float fRegrowTime, const std::string& sResourceName)
+	: m_RegrowQueue()
+	, m_eCellType(eCellType)
+	, m_nRegrowWaitTick(static_cast<uint64_t>(std::ceil(fRegrowTime * fFPS)))
+	, m_nCurrentTick(0)
+	, m_bInitialized(false)
+	, m_sResourceName(sResourceName)
+{
+}
+
+/*****************************************
+	@brief@	| t[̍XV
+	@param@	| nCurrentTickF݂̃t[
+	@param@	| nBudgetF̃t[ɐĂ悢IuWFNg
+	@return@	| IuWFNg
+*//*****************************************/
+int CRegrowthGenerator::Update(uint64_t nCurrentTick, int nBudget)
+{
+	m_nCurrentTick = nCurrentTick;
+
+	// 񐶐O̓tB[h쐬̂߉Ȃ
+	if (!m_bInitialized) return 0;
+
+	// VɌ͊ZL^
+	CollectDepletedCells();
+
+	// Đt[}Z܂Ő
+	int nCreateNum = 0;
+	while (nCreateNum < nBudget && !m_RegrowQueue.empty() && m_RegrowQueue.front().nRegrowTick <= m_nCurrentTick)
+	{
+		CFieldCell* pCell = m_RegrowQueue.front().pCell;
+		m_RegrowQueue.pop_front();
+
+		// ҂ĂԂɎgpꂽA܂̓^CvςZ͏O
+		if (pCell->IsUse() || pCell->GetCellType() != m_eCellType) continue;
+
+		SpawnResource(pCell);
+		nCreateNum++;
+	}
+
+	return nCreateNum;
+}
+
+/*****************************************
+	@brief@	| 
+*//*****************************************/
+void CRegrowthGenerator::Generate()
+{
+	// ̓tB[h쐬Ȃ̂ŁA󂢂ĂZSĂɂ̏Ő
+	if (!m_bInitialized)
+	{
+		m_bInitialized = true;
+
+		auto cells = CFieldManager::GetInstance()->GetFieldGrid()->TakeFreedCells(m_eCellType);
+		for (CFieldCell* pCell : cells)
+		{
+			SpawnResource(pCell);
+		}
+
+		// fobOO̒ǉ
+		CImguiSystem::GetInstance()->AddDebugLog(m_sResourceName + std::string(u8"") + std::to_string(cells.size()) + std::string(u8"܂"), false);
+		return;
+	}
+
+	// L^̌͊Z荞łAĐ҂̃ZSčĐ\ɂ
+	CollectDepletedCells();
+	for (RegrowEntry& entry : m_RegrowQueue)
+	{
+		entry.nRegrowTick = m_nCurrentTick;
+	}
+
+	// fobOO̒ǉ
+	CImguiSystem::GetInstance()->AddDebugLog(m_sResourceName + std::string(u8"̍Đ") + std::to_string(m_RegrowQueue.size()) + std::string(u8"\񂵂܂"), false);
+}
+
+/*****************************************
+	@brief@	| VɌ͊ZĐ҂ɒǉ
+*//*****************************************/
+void CRegrowthGenerator::CollectDepletedCells()
+{
+	// Oȍ~ɋ󂢂ZɍĐt[tĖɒǉ
+	for (CFieldCell* pCell : CFieldManager::GetInstance()->GetFieldGrid()->TakeFreedCells(m_eCellType))
+	{
+		m_RegrowQueue.push_back({ pCell, m_nCurrentTick + m_nRegrowWaitTick });
+	}
+}
@@ -0,0 +1,310 @@
+/**************************************************//*
+	@file	| RestSlotAllocator.cpp
+	@brief	| xe{݂̘g蓖ăVXecppt@C
+	@note	| xe{݂Ƃ̎gpgƑ҂sǗA
+			| xelԂɋ󂫘g҂s̏Ԃ蓖Ă
+			| g󂢂҂ĂlԂɏԂɊ蓖Ă
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "RestSlotAllocator.h"
+#include "RefreshFacility.h"
+#include "Human.h"
+#include "BuildManager.h"
+#include "StructMath.h"
+#include <algorithm>
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CRestSlotAllocator::CRestSlotAllocator()
+	: m_Slots()
+	, m_Tickets()
+	, m_FreeFacilities()
+	, m_QueueOrder()
+	, m_UnassignedWaiters()
+	, m_nNextSerial(0)
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CRestSlotAllocator::~CRestSlotAllocator()
+{
+}
+
+/*****************************************//*
+	@brief@	| xe{݂̓o^
+	@param		| pFacilityFo^xe{
+*//*****************************************/
+void CRestSlotAllocator::AddFacility(CRefreshFacility* pFacility)
+{
+	if (m_Slots.count(pFacility) != 0) return;
+
+	FacilitySlot& slot = m_Slots[pFacility];
+	slot.nSerial = m_nNextSerial++;
+	slot.nReserved = 0;
+	slot.isInFreeList = false;
+	InsertQueueKey(pFacility, slot);
+	UpdateFreeList(pFacility, slot);
+
+	// ҂ĂlԂɘg蓖Ă
+	GrantWaiters(pFacility);
+}
+
+/*****************************************//*
+	@brief@	| xe{݂̓o^
+	@param		| pFacilityFo^xe{
+*//*****************************************/
+void CRestSlotAllocator::RemoveFacility(CRefreshFacility* pFacility)
+{
+	auto itSlot = m_Slots.find(pFacility);
+	if (itSlot == m_Slots.end()) return;
+
+	// 󂫘gXgƑ҂s񏇂폜
+	EraseQueueKey(pFacility, itSlot->second);
+	if (itSlot->second.isInFreeList)
+	{
+		m_FreeFacilities.erase(std::remove(m_FreeFacilities.begin(), m_FreeFacilities.end(), pFacility), m_FreeFacilities.end());
+	}
+	m_Slots.erase(itSlot);
+
+	// ̎{݂ւ̊蓖Ăji{݂̔ĵ݂Ȃ̂őŜ𑖍j
+	for (auto it = m_Tickets.begin(); it != m_Tickets.end();)
+	{
+		if (it->second.pFacility == pFacility) it = m_Tickets.erase(it);
+		else ++it;
+	}
+}
+
+/*****************************************//*
+	@brief@	| xe{݂̎gp\l̕ύXʒm
+	@param		| pFacilityFύXxe{
+*//*****************************************/
+void CRestSlotAllocator::OnCapacityChanged(CRefreshFacility* pFacility)
+{
+	auto itSlot = m_Slots.find(pFacility);
+	if (itSlot == m_Slots.end()) return;
+
+	UpdateFreeList(pFacility, itSlot->second);
+	GrantWaiters(pFacility);
+}
+
+/*****************************************//*
+	@brief@	| xeg̗v
+	@param		| pHumanFxel
+	@return		| 蓖Ăꂽxe{݁A{݂1nullptr
+*//*****************************************/
+CRefreshFacility* CRestSlotAllocator::Request(CHuman* pHuman)
+{
+	// 蓖čς݂Ȃ炻̂܂ܕԂ
+	auto itTicket = m_Tickets.find(pHuman);
+	if (itTicket != m_Tickets.end()) return itTicket->second.pFacility;
+
+	// 󂫘g΍ł߂{݂̘g蓖Ă
+	CRefreshFacility* pFacility = FindNearestFreeFacility(pHuman);
+	if (pFacility != nullptr)
+	{
+		Grant(pHuman, pFacility, m_Slots[pFacility]);
+		return pFacility;
+	}
+
+	// 󂫘ĝŋxe{݂̌z˗i҂n߂̈xj
+	CBuildManager::GetInstance()->AddBuildRequest(CBuildManager::BuildType::RefreshFacility);
+
+	// {݂1ꍇ͌z܂ő҂
+	if (m_QueueOrder.empty())
+	{
+		m_Tickets[pHuman] = { nullptr, false };
+		m_UnassignedWaiters.push_back(pHuman);
+		return nullptr;
+	}
+
+	// ҂s񂪍łZ{݂ɕ
+	pFacility = m_QueueOrder.begin()->pFacility;
+	FacilitySlot& slot = m_Slots[pFacility];
+	EraseQueueKey(pFacility, slot);
+	slot.waiting.push_back(pHuman);
+	InsertQueueKey(pFacility, slot);
+	m_Tickets[pHuman] = { pFacility, false };
+
+	return pFacility;
+}
+
+/*****************************************//*
+	@brief@	| gpg蓖ĂĂ邩ǂ
+	@param		| pHumanFmFl
+	@return		| true:gpł false:ҋ@A܂͖v
+*//*****************************************/
+bool CRestSlotAllocator::IsGranted(CHuman* pHuman) const
+{
+	auto itTicket = m_Tickets.find(pHuman);
+	return itTicket != m_Tickets.end() && itTicket->second.isGranted;
+}
+
+/*****************************************//*
+	@brief@	| xeg̉
+	@param		| pHumanFxeIl
+*//*****************************************/
+void CRestSlotAllocator::Release(CHuman* pHuman)
+{
+	auto itTicket = m_Tickets.find(pHuman);
+	if (itTicket == m_Tickets.end()) return;
+
+	RestTicket ticket = itTicket->second;
+	m_Tickets.erase(itTicket);
+
+	// {݂̌z҂ꍇ
+	if (ticket.pFacility == nullptr)
+	{
+		m_UnassignedWaiters.erase(std::remove(m_UnassignedWaiters.begin(), m_UnassignedWaiters.end(), pHuman), m_UnassignedWaiters.end());
+		return;
+	}
+
+	FacilitySlot& slot = m_Slots[ticket.pFacility];
+
+	// ҂sɕłꍇ͗񂩂甲
+	if (!ticket.isGranted)
+	{
+		EraseQueueKey(ticket.pFacility, slot);
+		slot.waiting.erase(std::remove(slot.waiting.begin(), slot.waiting.end(), pHuman), slot.waiting.end());
+		InsertQueueKey(ticket.pFacility, slot);
+		return;
+	}
+
+	// gpgA҂ĂlԂɊ蓖Ă
+	ticket.pFacility->ReleaseRefreshFacility(*pHuman);
+	slot.nReserved--;
+	UpdateFreeList(ticket.pFacility, slot);
+	GrantWaiters(ticket.pFacility);
+}
+
+/*****************************************//*
+	@brief@	| gpg蓖Ă
+	@param		| pHumanF蓖Ăl
+	@param		| pFacilityFxe{
+	@param		| slotFxe{݂̘g
+*//*****************************************/
+void CRestSlotAllocator::Grant(CHuman* pHuman, CRefreshFacility* pFacility, FacilitySlot& slot)
+{
+	slot.nReserved++;
+	m_Tickets[pHuman] = { pFacility, true };
+	UpdateFreeList(pFacility, slot);
+}
+
+/*****************************************//*
+	@brief@	| 󂢂Ăgpg҂ĂlԂɊ蓖Ă
+	@param		| pFacilityFg󂢂xe{
+	@note		| {݂̑҂sAł҂sA{݂̌z҂̏Ɋ蓖Ă
+*//*****************************************/
+void CRestSlotAllocator::GrantWaiters(CRefreshFacility* pFacility)
+{
+	FacilitySlot& slot = m_Slots[pFacility];
+	while (slot.nReserved < pFacility->GetCapacity())
+	{
+		// {݂̑҂s
+		if (!slot.waiting.empty())
+		{
+			EraseQueueKey(pFacility, slot);
+			CHuman* pHuman = slot.waiting.front();
+			slot.waiting.pop_front();
+			InsertQueueKey(pFacility, slot);
+			Grant(pHuman, pFacility, slot);
+			continue;
+		}
+
+		// ̎{݂ōł҂s
+		if (!m_QueueOrder.empty() && m_QueueOrder.rbegin()->nWaiting > 0)
+		{
+			CRefreshFacility* pOther = m_QueueOrder.rbegin()->pFacility;
+			FacilitySlot& other = m_Slots[pOther];
+			EraseQueueKey(pOther, other);
+			CHuman* pHuman = other.waiting.front();
+			other.waiting.pop_front();
+			InsertQueueKey(pOther, other);
+			Grant(pHuman, pFacility, slot);
+			continue;
+		}
+
+		// {݂̌z҂
+		if (!m_UnassignedWaiters.empty())
+		{
+			CHuman* pHuman = m_UnassignedWaiters.front();
+			m_UnassignedWaiters.pop_front();
+			Grant(pHuman, pFacility, slot);
+			continue;
+		}
+
+		break;
+	}
+}
+
+/*****************************************//*
+	@brief@	| 󂫘ĝ{݃Xg̍XV
+	@param		| pFacilityFxe{
+	@param		| slotFxe{݂̘g
+*//*****************************************/
+void CRestSlotAllocator::UpdateFreeList(CRefreshFacility* pFacility, FacilitySlot& slot)
+{
+	bool isFree = slot.nReserved < pFacility->GetCapacity();
+	if (isFree == slot.isInFreeList) return;
+
+	slot.isInFreeList = isFree;
+	if (isFree)
+	{
+		m_FreeFacilities.push_back(pFacility);
+	}
+	else
+	{
+		// Ԃ͖Ȃ̂ŖƓւč폜
+		auto it = std::find(m_FreeFacilities.begin(), m_FreeFacilities.end(), pFacility);
+		*it = m_FreeFacilities.back();
+		m_FreeFacilities.pop_back();
+	}
+}
+
+/*****************************************//*
+	@brief@	| ҂s̒ςOɃL[O
+	@param		| pFacilityFxe{
+	@param		| slotFxe{݂̘g
+*//*****************************************/
+void CRestSlotAllocator::EraseQueueKey(CRefreshFacility* pFacility, const FacilitySlot& slot)
+{
+	m_QueueOrder.erase({ slot.waiting.size(), slot.nSerial, pFacility });
+}
+
+/*****************************************//*
+	@brief@	| ҂s̒ςɃL[꒼
+	@param		| pFacilityFxe{
+	@param		| slotFxe{݂̘g
+*//*****************************************/
+void CRestSlotAllocator::InsertQueueKey(CRefreshFacility* pFacility, const FacilitySlot& slot)
+{
+	m_QueueOrder.insert({ slot.waiting.size(), slot.nSerial, pFacility });
+}
+
+/*****************************************//*
+	@brief@	| ł߂󂫘ĝ{݂T
+	@param		| pHumanFxel
+	@return		| ł߂{݁A󂫘gnullptr
+	@note		| {݂͑SĖ̎ɂ1ẑŁA󂫘ĝ{݂͐x
+				| 蓖čς݂̐lԂ͌Ȃ̂ŁAxe1ɂ1x`ɒT
+*//*****************************************/
+CRefreshFacility* CRestSlotAllocator::FindNearestFreeFacility(CHuman* pHuman) const
+{
+	CRefreshFacility* pNearest = nullptr;
+	float fNearestDistance = 0.0f;
+	DirectX::XMFLOAT3 f3Pos = pHuman->GetPos();
+
+	for (CRefreshFacility* pFacility : m_FreeFacilities)
+	{
+		float fDistance = StructMath::Distance(f3Pos, pFacility->GetPos());
+		if (pNearest == nullptr || fDistance < fNearestDistance)
+		{
+			pNearest = pFacility;
+			fNearestDistance = fDistance;
+		}
+	}
+
+	return pNearest;
+}
@@ -0,0 +1,130 @@
+/**************************************************//*
+	@file	| RestSlotAllocator.h
+	@brief	| xe{݂̘g蓖ăVXeht@C
+	@note	| xe{݂Ƃ̎gpgƑ҂sǗA
+			| xelԂɋ󂫘g҂s̏Ԃ蓖Ă
+			| g󂢂҂ĂlԂɏԂɊ蓖Ă
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include <deque>
+#include <set>
+#include <vector>
+#include <unordered_map>
+
+// O錾
+class CHuman;
+class CRefreshFacility;
+
+// @brief xe{݂̘g蓖ăVXeNX
+class CRestSlotAllocator : public ISingleton<CRestSlotAllocator>
+{
+private:
+	// @brief RXgN^
+	CRestSlotAllocator();
+
+	friend class ISingleton<CRestSlotAllocator>;
+
+public:
+	// @brief fXgN^
+	~CRestSlotAllocator();
+
+	// @brief xe{݂̓o^
+	// @param pFacilityFo^xe{
+	// @note {݂đ҂ĂlԂA̎{݂̑҂s񂩂g蓖Ă
+	void AddFacility(CRefreshFacility* pFacility);
+
+	// @brief xe{݂̓o^
+	// @param pFacilityFo^xe{
+	// @note gpEҋ@̐lԂ̊蓖Ă͔jA̗vŊ蓖Ē
+	void RemoveFacility(CRefreshFacility* pFacility);
+
+	// @brief xe{݂̎gp\l̕ύXʒm
+	// @param pFacilityFύXxe{
+	void OnCapacityChanged(CRefreshFacility* pFacility);
+
+	// @brief xeg̗v
+	// @param pHumanFxel
+	// @return 蓖Ăꂽxe{݁igpg҂sjA{݂1nullptr
+	// @note 蓖čς݂̏ꍇ͓{݂Ԃ
+	CRefreshFacility* Request(CHuman* pHuman);
+
+	// @brief gpg蓖ĂĂ邩ǂ
+	// @param pHumanFmFl
+	// @return true:gpł false:ҋ@A܂͖v
+	bool IsGranted(CHuman* pHuman) const;
+
+	// @brief xeg̉
+	// @param pHumanFxeIl
+	// @note gpgꍇ͑҂ĂlԂɊ蓖Ă
+	void Release(CHuman* pHuman);
+
+private:
+	// @brief xe{݂Ƃ̘g
+	struct FacilitySlot
+	{
+		int nSerial;					// o^̔ԍ
+		int nReserved;					// 蓖čς݂̎gpgiړ܂ށj
+		bool isInFreeList;				// 󂫘ĝ{݃XgɓĂ邩
+		std::deque<CHuman*> waiting;	// ҂s
+	};
+
+	// @brief lԂƂ̊蓖ď
+	struct RestTicket
+	{
+		CRefreshFacility* pFacility;	// 蓖Ăꂽ{݁i{݂ꍇnullptrj
+		bool isGranted;					// gpg蓖ĂĂ邩
+	};
+
+	// @brief ҂s̒̃L[
+	struct QueueKey
+	{
+		size_t nWaiting;				// ҂l
+		int nSerial;					// o^̔ԍ
+		CRefreshFacility* pFacility;	// {
+
+		bool operator<(const QueueKey& other) const
+		{
+			if (nWaiting != other.nWaiting) return nWaiting < other.nWaiting;
+			return nSerial < other.nSerial;
+		}
+	};
+
+	// @brief gpg蓖Ă
+	void Grant(CHuman* pHuman, CRefreshFacility* pFacility, FacilitySlot& slot);
+
+	// @brief 󂢂Ăgpg҂ĂlԂɊ蓖Ă
+	void GrantWaiters(CRefreshFacility* pFacility);
+
+	// @brief 󂫘ĝ{݃Xg̍XV
+	void UpdateFreeList(CRefreshFacility* pFacility, FacilitySlot& slot);
+
+	// @brief ҂s̒ςOɃL[O
+	void EraseQueueKey(CRefreshFacility* pFacility, const FacilitySlot& slot);
+
+	// @brief ҂s̒ςɃL[꒼
+	void InsertQueueKey(CRefreshFacility* pFacility, const FacilitySlot& slot);
+
+	// @brief ł߂󂫘ĝ{݂T
+	CRefreshFacility* FindNearestFreeFacility(CHuman* pHuman) const;
+
+private:
+	// @brief xe{݂Ƃ̘g
+	std::unordered_map<CRefreshFacility*, FacilitySlot> m_Slots;
+
+	// @brief lԂƂ̊蓖ď
+	std::unordered_map<CHuman*, RestTicket> m_Tickets;
+
+	// @brief 󂫘ĝ{݃Xgił߂{݂͂̒Tj
+	std::vector<CRefreshFacility*> m_FreeFacilities;
+
+	// @brief ҂s̒Z̎{
+	std::set<QueueKey> m_QueueOrder;
+
+	// @brief {݂1ɋxevl
+	std::deque<CHuman*> m_UnassignedWaiters;
+
+	// @brief Ɋ蓖Ăo^̔ԍ
+	int m_nNextSerial;
+};
@@ -127,6 +127,7 @@ void CScene::Uninit()
 
 	// Xg̃NA
 	m_tIDVec.clear();
+	m_SameNameCount.clear();
 }
 
 /****************************************//*
@@ -7,6 +7,9 @@
 #include "GameObject.h"
 #include <array>
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // @brief シーンベースクラス
 class CScene
@@ -50,16 +53,8 @@ public:
 
 		// オブジェクトIDの設定
         ObjectID id{};
-		// 同じ名前のオブジェクトがいくつあるかカウント
-        for (auto itr : m_tIDVec)
-        {
-			// もし同じ名前のオブジェクトがいたらカウントを増やす
-            if (itr.m_sName == inName)
-            {
-				// 同じ名前のオブジェクト数をカウントアップ
-                id.m_nSameCount++;
-            }
-        }
+		// 同じ名前のオブジェクトがいくつあるかを名前ごとのカウンタから取得
+        id.m_nSameCount = m_SameNameCount[inName]++;
 		// オブジェクトIDの名前と同じ名前のオブジェクト数を設定
         id.m_sName = inName;
         m_tIDVec.push_back(id);
@@ -76,6 +71,58 @@ public:
 		return gameObject;
 	}
 
+    // @brief 同じ種類のゲームオブジェクトをまとめて追加する
+	// @tparam T：追加するCGameObject型のゲームオブジェクトクラス
+	// @param inTag：識別用のタグ
+	// @param inName：オブジェクトの名前
+	// @param nCount：追加する数
+	// @return 追加したゲームオブジェクトクラスのポインタ（生成に失敗した分は含まない）
+	// @note 名前ごとのカウンタの検索とゲームオブジェクトリストへの連結を1回にまとめる
+	//       AddGameObjectと同じく、リストに追加してから初期化処理を呼ぶ
+	template<typename T = CGameObject>
+	std::vector<T*> AddGameObjects(Tag inTag, std::string inName, size_t nCount)
+	{
+		std::vector<T*> gameObjects;
+		if (nCount == 0) return gameObjects;
+		gameObjects.reserve(nCount);
+
+		// 同じ名前のオブジェクト数のカウンタは1回だけ検索する
+		int& nSameCount = m_SameNameCount[inName];
+		m_tIDVec.reserve(m_tIDVec.size() + nCount);
+
+		// 一時リストに生成してから、ゲームオブジェクトリストにまとめて連結する
+		std::list<CGameObject*> staging;
+		for (size_t i = 0; i < nCount; ++i)
+		{
+			// ゲームオブジェクトをインスタンス化
+			T* gameObject = new(std::nothrow) T();
+			if (gameObject == nullptr) continue;
+			staging.push_back(gameObject);
+
+			// オブジェクトIDの設定
+			ObjectID id{};
+			id.m_nSameCount = nSameCount++;
+			id.m_sName = inName;
+			m_tIDVec.push_back(id);
+			gameObject->SetID(id);
+
+			gameObjects.push_back(gameObject);
+		}
+		m_pGameObject_List[(int)inTag].splice(m_pGameObject_List[(int)inTag].end(), staging);
+
+		for (T* gameObject : gameObjects)
+		{
+			// ゲームオブジェクトの初期化処理
+			gameObject->Init();
+
+			// ゲームオブジェクトにタグを設定
+			gameObject->SetTag(inTag);
+		}
+
+		// 追加したゲームオブジェクトを返す
+		return gameObjects;
+	}
+
     // @brief ゲームオブジェクトを取得する
 	// @tparam T：取得するCGameObject型のゲームオブジェクトクラス
 	// @return 一番最初に見つかったCGameObject型のポインタ、見つからなかった場合はnullptr
@@ -348,6 +395,9 @@ private:
 	// @brief シーン内の全てのオブジェクトIDリスト
     std::vector<ObjectID> m_tIDVec;
 
+	// @brief 名前ごとの生成数（IDリストを走査せずに同名オブジェクト数を求める）
+    std::unordered_map<std::string, int> m_SameNameCount;
+
 	// @brief フェード中かどうかのフラグ
     bool m_bFade = false;
 
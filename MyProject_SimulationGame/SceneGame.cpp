@@ -14,6 +14,17 @@
 #include "SkyBox.h"
 #include "ImguiSystem.h"
 #include "Animal.h"
+#include "TaskBoardManager.h"
+#include "ProductionManager.h"
+#include "VitalsManager.h"
+#include "DecisionScheduler.h"
+#include "RestSlotAllocator.h"
+#include "AnimalSpatialGrid.h"
+#include "AnimalSimulation.h"
+#include "FlockManager.h"
+#include "Random.h"
+#include "AnimalDeathManager.h"
+#include <new>
 
 /****************************************//*
 	@brief@	| RXgN^
@@ -32,6 +43,15 @@ CSceneGame::~CSceneGame()
 	CFieldManager::ReleaseInstance();
 	CGeneratorManager::ReleaseInstance();
 	CBuildManager::ReleaseInstance();
+	CTaskBoardManager::ReleaseInstance();
+	CProductionManager::ReleaseInstance();
+	CVitalsManager::ReleaseInstance();
+	CDecisionScheduler::ReleaseInstance();
+	CRestSlotAllocator::ReleaseInstance();
+	CAnimalSpatialGrid::ReleaseInstance();
+	CAnimalSimulation::ReleaseInstance();
+	CFlockManager::ReleaseInstance();
+	CAnimalDeathManager::ReleaseInstance();
 }
 
 /****************************************//*
@@ -47,11 +67,11 @@ void CSceneGame::Init()
 
 	// ǗVXe̒ʒms
 	CGeneratorManager* pGeneratorManager = CGeneratorManager::GetInstance();
-	pGeneratorManager->AddObserver(*(new CWoodGenerator()));
-	pGeneratorManager->AddObserver(*(new CStoneGenerator()));
-	pGeneratorManager->AddObserver(*(new CGrassGenerator()));
-	pGeneratorManager->AddObserver(*(new CHumanGenerator()));
-	pGeneratorManager->AddObserver(*(new CAnimalGenerator()));
+	pGeneratorManager->SetGenerator(CGeneratorManager::GenerateType::Wood, new(std::nothrow) CWoodGenerator());
+	pGeneratorManager->SetGenerator(CGeneratorManager::GenerateType::Stone, new(std::nothrow) CStoneGenerator());
+	pGeneratorManager->SetGenerator(CGeneratorManager::GenerateType::Grass, new(std::nothrow) CGrassGenerator());
+	pGeneratorManager->SetGenerator(CGeneratorManager::GenerateType::Human, new(std::nothrow) CHumanGenerator());
+	pGeneratorManager->SetGenerator(CGeneratorManager::GenerateType::Animal, new(std::nothrow) CAnimalGenerator());
 
 	// tB[hǗVXȅ
 	CFieldManager::GetInstance()->AssignFieldCellType();
@@ -68,9 +88,21 @@ void CSceneGame::Init()
 *//****************************************/
 void CSceneGame::Update()
 {
+	// ̃eBbNi߂i̓V[hE́EeBbNŌ܂j
+	Random::AdvanceTick();
+
+	// ̈ʒuL^AS̃XeAOɌvZi̍XVɈˑȂj
+	CAnimalSimulation::GetInstance()->Update();
+
 	// NX̍XV
 	CScene::Update();
 
+	// ľƂl܂Ƃ߂čs
+	CVitalsManager::GetInstance()->Update();
+
+	// lԂ̏ԌiSt[ƃCxgŗvꂽlԂ̂݁j
+	CDecisionScheduler::GetInstance()->Update();
+
 	// ǗVXe̍XV
 	CGeneratorManager::GetInstance()->Update();
 
@@ -80,6 +112,12 @@ void CSceneGame::Update()
 	// N[^C
 	CBuildManager::GetInstance()->CoolTimeUpdate();
 
+	// \}{݂̐Yʒm
+	CProductionManager::GetInstance()->Update();
+
+	// ̎Eւ̍Ɗ蓖ď
+	CTaskBoardManager::GetInstance()->Update();
+
 	// 폜\ȃIuWFNg̍폜
 	for (auto& Objectlist : m_pGameObject_List)
 	{
@@ -96,6 +134,8 @@ void CSceneGame::Update()
 		});
 	}
 
+	// ̃t[ɔjꂽ̕ߐHƃZ̉
+	CAnimalDeathManager::GetInstance()->Update();
 }
 
 /****************************************//*
@@ -8,6 +8,7 @@
 #include <vector>
 #include "JobOperator.h"
 #include "ImguiSystem.h"
+#include "Random.h"
 
 /****************************************//*
 	@brief@	| RXgN^
@@ -17,7 +18,7 @@ CSkill::CSkill()
 	, m_eSkillEffect(SkillEffect::None)
 {
 	// XLʂ_ɐݒ
-	m_eSkillTarget = static_cast<SkillTarget>(rand() % static_cast<int>(SkillTarget::MAX));
+	m_eSkillTarget = static_cast<SkillTarget>(Random::Global().Range(0, static_cast<int>(SkillTarget::MAX)));
 
 	// XLΏۂɉăXLʂݒ
 	std::vector<SkillEffect> randomEffects;
@@ -54,7 +55,7 @@ CSkill::CSkill()
 
 	// _ɃXLʂI
 	if (randomEffects.empty())m_eSkillEffect = SkillEffect::None;
-	else m_eSkillEffect = randomEffects[rand() % randomEffects.size()];
+	else m_eSkillEffect = randomEffects[Random::Global().Range(0, static_cast<int>(randomEffects.size()))];
 
 }
 
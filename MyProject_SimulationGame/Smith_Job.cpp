@@ -60,8 +60,11 @@ void CSmith_Job::OnChangeJob()
 	{
 		// ԋ߂b艮T
 		CBlackSmith* pNearestBlackSmith = GetScene()->GetGameObject<CBlackSmith>(m_pOwner->GetPos());
-		// ˗Zbg
-		pNearestBlackSmith->ResetRequest(m_pRequest);
+		// b艮ꍇ͈˗Zbg
+		if (pNearestBlackSmith != nullptr)
+		{
+			pNearestBlackSmith->ResetRequest(m_pRequest);
+		}
 		// ˗|C^Zbg
 		m_pRequest = nullptr;
 	}
@@ -231,71 +234,9 @@ void CSmith_Job::GatheringMaterialsAction()
 	// ɂɈړ
 	if (!m_pOwner->MoveToTarget(storageHouses, Human_Move_Speed))return;
 
-	// fގW
-	std::vector<CItem::Material> HasMaterials;
-	// fރXg̃TCYKvfރXg̃TCYɍ킹
-	HasMaterials.resize(requiredMaterials.size());
-
-	// ĂACeXg擾
-	const auto& ownedItems = m_pOwner->GetItemList();
-
-	// fރXg̏
-	if (!ownedItems.empty())
-	{
-		// ĂACeXg猚zfނ݂̂𒊏o
-		for (int i = 0; i < requiredMaterials.size(); i++)
-		{
-			// fރXg𑖍
-			for (const auto& item : ownedItems)
-			{
-				// fރ^Cvvꍇ
-				if (item->GetItemType() == requiredMaterials[i].eItemType)
-				{
-					// fރXgɒǉ
-					HasMaterials[i].eItemType = requiredMaterials[i].eItemType;
-					HasMaterials[i].nRequiredAmount++;
-				}
-			}
-		}
-	}
-
-	// SĂ̑fނW܂ǂ̃tO
-	bool bAllMaterialsGathered = true;
-
-	// KvfރXg[v
-	for (int i = 0; i < requiredMaterials.size(); i++)
-	{
-		// fނsĂ邩ǂ`FbN
-		if (HasMaterials[i].nRequiredAmount < requiredMaterials[i].nRequiredAmount)
-		{
-			// Kv߂
-			int nNeeded = requiredMaterials[i].nRequiredAmount - HasMaterials[i].nRequiredAmount;
-			if (nNeeded <= 0)continue;
-			// fނW
-			for (int n = 0; n < nNeeded; ++n)
-			{
-				// ɂfނo
-				auto Item = storageHouses->TakeOutItem(requiredMaterials[i].eItemType);
-
-				// oꍇ͎W𑝂₷
-				if (Item != nullptr)
-				{
-					m_pOwner->HoldItem(Item);
-					HasMaterials[i].nRequiredAmount--;
-					// o
-					return;
-				}
-				else
-				{
-					// fނȂꍇ̓tO܂
-					bAllMaterialsGathered = false;
-					// [v𔲂
-					break;
-				}
-			}
-
-		}
-	}
+	// sĂfނ𒙑ɂ܂Ƃ߂Ďo
+	// fނSđꍇ̂ݎoAꕔ܂Ȃ悤ɂ
+	bool bAllMaterialsGathered = WithdrawMaterials(storageHouses, requiredMaterials, false);
 
 	// SĂ̑fނW܂ꍇ͎̏ԂɈڍs
 	if (bAllMaterialsGathered)
@@ -338,10 +279,7 @@ void CSmith_Job::CraftingAction()
 	if (pProducedItem != nullptr)
 	{
 		// ĂACeSĎ
-		while (!m_pOwner->HasItem())
-		{
-			m_pOwner->TakeOutItem();
-		}
+		m_pOwner->ClearItems();
 
 		// Yi
 		m_pOwner->SetToolItem(pProducedItem);
@@ -0,0 +1,70 @@
+/**************************************************//*
+	@file	| SteeringMath.h
+	@brief	| XeAOvZp̃xNgZ
+	@note	| XMFLOAT3͊֐̓1񂾂XMVECTORɓǂݍ݁Ao1񂾂߂
+			| r̉ZEEKXMVECTOR̂܂SIMDōs
+*//**************************************************/
+#pragma once
+#include <DirectXMath.h>
+
+// XeAOvZp̃xNgZ̖O
+namespace SteeringMath
+{
+	// @brief 0Ƃ݂Ȃl
+	constexpr float EPSILON_LENGTH = 0.0001f;
+
+	// @brief Bς݂Ƃ݂Ȃ
+	constexpr float EPSILON_DISTANCE = 0.001f;
+
+	// @brief XMFLOAT3̓ǂݍ
+	// @param f3Fǂݍޒl
+	// @return w0̃xNg
+	inline DirectX::XMVECTOR Load(const DirectX::XMFLOAT3& f3)
+	{
+		return DirectX::XMLoadFloat3(&f3);
+	}
+
+	// @brief XMFLOAT3ւ̏߂
+	// @param vF߂xNg
+	// @return x,y,z
+	inline DirectX::XMFLOAT3 Store(DirectX::FXMVECTOR v)
+	{
+		DirectX::XMFLOAT3 f3;
+		DirectX::XMStoreFloat3(&f3, v);
+		return f3;
+	}
+
+	// @brief xNg̒
+	// @param vFxNg
+	inline float Length(DirectX::FXMVECTOR v)
+	{
+		return DirectX::XMVectorGetX(DirectX::XMVector3Length(v));
+	}
+
+	// @brief xNg̒𐧌
+	// @param vFxNg
+	// @param maxLenFő咷
+	// @return xNg
+	inline DirectX::XMVECTOR Limit(DirectX::FXMVECTOR v, float maxLen)
+	{
+		const float len = Length(v);
+		if (len > maxLen && len > EPSILON_LENGTH) return DirectX::XMVectorScale(v, maxLen / len);
+		return v;
+	}
+
+	// @brief wɍő呬xŐiނ߂̃XeAO
+	// @param dirFi݂iKsvj
+	// @param velFݑx
+	// @param maxSpeedFő呬x
+	// @param maxForceFő
+	// @return XeAOxNgAɒ[ɒZꍇ0
+	inline DirectX::XMVECTOR SteerToward(DirectX::FXMVECTOR dir, DirectX::FXMVECTOR vel, float maxSpeed, float maxForce)
+	{
+		const float dist = Length(dir);
+		if (dist < EPSILON_DISTANCE) return DirectX::XMVectorZero();
+
+		// zxƌݑx̍ő͂Ő
+		const DirectX::XMVECTOR desired = DirectX::XMVectorScale(dir, maxSpeed / dist);
+		return Limit(DirectX::XMVectorSubtract(desired, vel), maxForce);
+	}
+}
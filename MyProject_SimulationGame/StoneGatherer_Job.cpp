@@ -19,14 +19,16 @@ CStoneGatherer_Job::CStoneGatherer_Job()
 }
 
 /******************************************//*
-	@brief@	| WIT
-	@return		| ̎ΏۃIuWFNg̃|C^
+	@brief@	| WǏT
+	@param		| nMaxCountF擾ő吔
+	@return		| \ŋ߂ɕ񂾍̎ΏۃIuWFNg̃|C^Xg
 	@note		| ΃IuWFNgT
 *//******************************************/
-CCollectTarget* CStoneGatherer_Job::SearchTarget(std::vector<ObjectID> vNotTargetIDs)
+std::vector<CCollectTarget*> CStoneGatherer_Job::SearchTargets(const size_t nMaxCount)
 {
 	// ΃IuWFNgT
-	return GetScene()->GetGameObject<CStone>(m_pOwner->GetPos(), vNotTargetIDs);
+	std::vector<CStone*> targets = CCollectTarget::FindUnclaimedCandidates<CStone>(m_pOwner->GetPos(), nMaxCount);
+	return std::vector<CCollectTarget*>(targets.begin(), targets.end());
 }
 
 /******************************************//*
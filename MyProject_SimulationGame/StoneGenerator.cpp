@@ -2,34 +2,28 @@
 	@file	| StoneGenerator.cpp
 	@brief	| ΃WFl[^[NXcppt@C
 	@note	| ΂𐶐WFl[^[
-			| IGeneratorp
+			| CRegrowthGeneratorp
 *//**************************************************/
 #include "StoneGenerator.h"
 #include "Stone.h"
 #include "Main.h"
-#include "ImguiSystem.h"
 
 #undef min
 
 /*****************************************
-	@brief@	| 
+	@brief@	| RXgN^
 *//*****************************************/
-void CStoneGenerator::Generate()
+CStoneGenerator::CStoneGenerator()
+	: CRegrowthGenerator(CFieldCell::CellType::ROCK, REGROW_TIME, u8"")
 {
-	// zu\ȖgpZ擾
-	auto cells = CFieldManager::GetInstance()->GetFieldGrid()->GetFieldCells(CFieldCell::CellType::ROCK, false);
-
-	// zu\ȃZȂΏI
-	if (cells.empty()) return;
-
-	int createNum = 0;
-	for(auto cell : cells)
-	{
-		// ΃IuWFNg𐶐AIoZɔzu
-		GetScene()->AddGameObject<CStone>(Tag::GameObject, u8"")->SetCreatePos(cell);
-		createNum++;
-	}
+}
 
-	// fobOO̒ǉ
-	CImguiSystem::GetInstance()->AddDebugLog(std::string(u8"΂") + std::to_string(createNum) + std::string(u8"܂"), false);
+/*****************************************
+	@brief@	| IuWFNg̐
+	@param@	| pCellF̃Z
+*//*****************************************/
+void CStoneGenerator::SpawnResource(CFieldCell* pCell)
+{
+	// ΃IuWFNg𐶐AZɔzu
+	GetScene()->AddGameObject<CStone>(Tag::GameObject, u8"")->SetCreatePos(pCell);
 }
@@ -2,16 +2,23 @@
 	@file	| StoneGenerator.h
 	@brief	| ΃WFl[^[NXht@C
 	@note	| ΂𐶐WFl[^[
-			| IGeneratorp
+			| CRegrowthGeneratorp
 *//**************************************************/
 #pragma once
 #include "Generator.h"
 
 // @brief ΃WFl[^[NX
-class CStoneGenerator final : public IGenerator
+class CStoneGenerator final : public CRegrowthGenerator
 {
+public:
+	// @brief ͊ĂĐ܂ł̎ԁibj
+	static constexpr float REGROW_TIME = 120.0f;
+
+	// @brief RXgN^
+	CStoneGenerator();
+
 private:
-	// @brief 
-	void Generate() override;
+	// @brief IuWFNg̐
+	// @param pCellF̃Z
+	void SpawnResource(CFieldCell* pCell) override;
 };
-
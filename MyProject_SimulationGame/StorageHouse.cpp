@@ -8,6 +8,10 @@
 #include "ModelRenderer.h"
 #include "ImguiSystem.h"
 #include "ShaderManager.h"
+#include "FoodFactory.h"
+#include "Main.h"
+#include <array>
+#include <new>
 
 /*****************************************//*
 	@brief@	| RXgN^
@@ -22,6 +26,13 @@ CStorageHouse::CStorageHouse()
 *//*****************************************/
 CStorageHouse::~CStorageHouse()
 {
+	// Ď҂ɔjʒmiʒmɉĂǂ悤ɕđj
+	std::list<IStorageObserver*> observers = m_StorageObservers;
+	for (IStorageObserver* pObserver : observers)
+	{
+		pObserver->OnStorageDestroyed(this);
+	}
+	m_StorageObservers.clear();
 }
 
 /*****************************************//*
@@ -45,6 +56,11 @@ void CStorageHouse::Init()
 	// sNZVF[_[̐ݒ
 	pModelRenderer->SetPixelShader(pShaderManager->GetPixelShader(PSType::TexColor));
 
+	// ɂĎĂȂHH{݂ɐʒm
+	for (CFoodFactory* pFoodFactory : GetScene()->GetGameObjects<CFoodFactory>())
+	{
+		pFoodFactory->OnStorageHouseCreated(this);
+	}
 }
 
 /*****************************************//*
@@ -57,23 +73,18 @@ int CStorageHouse::Inspecter()
 	// NX̃CXyN^[\
 	int itemCount = CBuildObject::Inspecter();
 
-	// [ĂACeޕʂɃJEg
-	std::map<CItem::ITEM_TYPE, int> itemTypes;
-	for (CItem* pItem : m_StoredItems)
-	{
-		CItem::ITEM_TYPE type = pItem->GetItemType();
-		itemTypes[type]++;
-	}
-
 	// ACeނƂɕ\
 	ImGui::BeginChildFrame(ImGui::GetID((void*)0), ImVec2(280, 200));
 
-	for (const auto& pair : itemTypes)
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
 	{
+		CItem::ITEM_TYPE type = static_cast<CItem::ITEM_TYPE>(i);
+		if (m_StoredItems.GetCount(type) <= 0) continue;
+
 		// ACe̎擾
-		std::string itemName = CItem::ITEM_TYPE_TO_STRING(pair.first);
+		std::string itemName = CItem::ITEM_TYPE_TO_STRING(type);
 		// ACeƐʂ̕\
-		ImGui::Text(std::string(itemName + ":" + std::to_string(pair.second)).c_str());
+		ImGui::Text(std::string(itemName + ":" + std::to_string(m_StoredItems.GetCount(type))).c_str());
 	}
 
 	ImGui::EndChildFrame();
@@ -85,11 +96,58 @@ int CStorageHouse::Inspecter()
 /*****************************************//*
 	@brief@	| ACe̎[
 	@param		| pItemF[ACe
+	@note		| ƂċL^AACe|C^͉
 *//*****************************************/
 void CStorageHouse::StoreItem(CItem* pItem)
 {
-	// [ĂACeXgɒǉ
-	m_StoredItems.push_back(pItem);
+	if (pItem == nullptr) return;
+
+	// [ɉZiȃACe^Cv̔͌w̎[ōsj
+	StoreItem(pItem->GetItemType(), 1);
+
+	// ŊǗ邽߃ACe{͉̂
+	delete pItem;
+}
+
+/*****************************************//*
+	@brief@	| ACe̎[
+	@param		| eTypeF[ACe^Cv
+	@param		| nAmountF[
+*//*****************************************/
+void CStorageHouse::StoreItem(const CItem::ITEM_TYPE eType, const int nAmount)
+{
+	// ȃACe^Cv͎[̔z͈̔͊OɂȂ̂ŉȂ
+	if (nAmount <= 0 || eType >= CItem::ITEM_TYPE::MAX) return;
+
+	m_StoredItems.Add(eType, nAmount);
+	NotifyItemChanged(eType);
+}
+
+/*****************************************//*
+	@brief@	| ACeSĎ[
+	@param		| sourceF[̏ACeiɂȂj
+	@return		| [
+*//*****************************************/
+int CStorageHouse::StoreAll(CItemInventory& source)
+{
+	// Ď҂Ȃ΂̂܂܈ړ
+	if (m_StorageObservers.empty()) return source.TransferAll(m_StoredItems);
+
+	// ړOɏĂACe^CvL^ĂAړɂ܂Ƃ߂Ēʒm
+	std::array<bool, static_cast<int>(CItem::ITEM_TYPE::MAX)> aChanged{};
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
+	{
+		aChanged[i] = source.GetCount(static_cast<CItem::ITEM_TYPE>(i)) > 0;
+	}
+
+	int nMoved = source.TransferAll(m_StoredItems);
+
+	for (int i = 0; i < static_cast<int>(CItem::ITEM_TYPE::MAX); ++i)
+	{
+		if (aChanged[i]) NotifyItemChanged(static_cast<CItem::ITEM_TYPE>(i));
+	}
+
+	return nMoved;
 }
 
 /*****************************************//*
@@ -99,23 +157,12 @@ void CStorageHouse::StoreItem(CItem* pItem)
 *//*****************************************/
 CItem* CStorageHouse::TakeOutItem(CItem::ITEM_TYPE eType)
 {
-	// [ĂACeXgT
-	for (auto it = m_StoredItems.begin(); it != m_StoredItems.end(); ++it)
-	{
-		// w肳ꂽ^CṽACeT
-		if ((*it)->GetItemType() == eType)
-		{
-			// ACeo
-			CItem* pItem = *it;
-			// [ĂACeXg폜
-			m_StoredItems.erase(it);
-			// oACe|C^Ԃ
-			return pItem;
-		}
-	}
-
 	// w肳ꂽ^CṽACe݂ȂꍇnullptrԂ
-	return nullptr;
+	if (!m_StoredItems.Remove(eType)) return nullptr;
+	NotifyItemChanged(eType);
+
+	// oACe𐶐ĕԂ
+	return new(std::nothrow) CItem(eType);
 }
 
 /*****************************************//*
@@ -125,64 +172,47 @@ CItem* CStorageHouse::TakeOutItem(CItem::ITEM_TYPE eType)
 *//*****************************************/
 CItem* CStorageHouse::TakeOutItem(CItem::ITEM_CATEGORY eCategory)
 {
-	// [ĂACeXgT
-	for (auto it = m_StoredItems.begin(); it != m_StoredItems.end(); ++it)
-	{
-		// w肳ꂽJeS[̃ACeT
-		if ((*it)->GetItemCategory() == eCategory)
-		{
-			// ACeo
-			CItem* pItem = *it;
-			// [ĂACeXg폜
-			m_StoredItems.erase(it);
-			// oACe|C^Ԃ
-			return pItem;
-		}
-	}
+	// w肳ꂽJeS[̃ACeo
+	CItem::ITEM_TYPE eType = m_StoredItems.TakeByCategory(eCategory);
+	if (eType == CItem::ITEM_TYPE::MAX) return nullptr;
+	NotifyItemChanged(eType);
 
-	return nullptr;
+	// oACe𐶐ĕԂ
+	return new(std::nothrow) CItem(eType);
 }
 
 /*****************************************//*
-	@brief@	| w肵ACe^Cv݂邩ǂ擾
-	@param		| eTypeFACe^Cv
-	@return		| true:݂ false:݂Ȃ
+	@brief@	| fރXg܂Ƃ߂Ďo
+	@param		| materialsFofރXg
+	@param		| destFofނ̈ړ
+	@return		| true:SĎo false:sioȂj
 *//*****************************************/
-bool CStorageHouse::HasItemType(CItem::ITEM_TYPE eType) const
+bool CStorageHouse::TakeOutMaterials(const CItem::MaterialSpan& materials, CItemInventory& dest)
 {
-	// [ĂACeXgT
-	for (const CItem* pItem : m_StoredItems)
+	// łsĂΉoȂ
+	if (!m_StoredItems.Remove(materials)) return false;
+
+	// ofނړɒǉ
+	for (const CItem::Material& material : materials)
 	{
-		// w肳ꂽ^CṽACe݂邩ǂ`FbN
-		if (pItem->GetItemType() == eType)
-		{
-			return true;
-		}
+		dest.Add(material.eItemType, material.nRequiredAmount);
+		NotifyItemChanged(material.eItemType);
 	}
-
-	// w肳ꂽ^CṽACe݂ȂꍇfalseԂ
-	return false;
+	return true;
 }
 
 /*****************************************//*
-	@brief@	| w肵ACeJeS[݂邩ǂ擾
-	@param		| eCategoryFACeJeS[
-	@return		| true:݂ false:݂Ȃ
+	@brief@	| w肵ACe^Cv܂Ƃ߂Ďo
+	@param		| eTypeFoACe^Cv
+	@param		| nAmountFoő
+	@param		| destFoACëړ
+	@return		| ۂɎo
 *//*****************************************/
-bool CStorageHouse::HasItemCategory(CItem::ITEM_CATEGORY eCategory) const
+int CStorageHouse::TakeOutItems(const CItem::ITEM_TYPE eType, const int nAmount, CItemInventory& dest)
 {
-	// [ĂACeXgT
-	for (const CItem* pItem : m_StoredItems)
-	{
-		// w肳ꂽJeS[̃ACe݂邩ǂ`FbN
-		if (pItem->GetItemCategory() == eCategory)
-		{
-			return true;
-		}
-	}
-
-	// w肳ꂽJeS[̃ACe݂ȂꍇfalseԂ
-	return false;
+	int nMoved = m_StoredItems.Transfer(dest, eType, nAmount);
+	if (nMoved > 0) NotifyItemChanged(eType);
+	return nMoved;
 }
 
 /*****************************************//*
@@ -191,17 +221,20 @@ bool CStorageHouse::HasItemCategory(CItem::ITEM_CATEGORY eCategory) const
 *//*****************************************/
 bool CStorageHouse::HasFood() const
 {
-	// [ĂACeXgT
-	for (const CItem* pItem : m_StoredItems)
+	// JeS[Ƃ̍vŔ
+	return m_StoredItems.GetCategoryCount(CItem::ITEM_CATEGORY::CookedFood) > 0 ||
+		m_StoredItems.GetCategoryCount(CItem::ITEM_CATEGORY::UnCookedFood) > 0;
+}
+
+/*****************************************//*
+	@brief@	| [̕ωĎ҂֒ʒm
+	@param		| eTypeFωACe^Cv
+*//*****************************************/
+void CStorageHouse::NotifyItemChanged(const CItem::ITEM_TYPE eType)
+{
+	const int nCount = m_StoredItems.GetCount(eType);
+	for (IStorageObserver* pObserver : m_StorageObservers)
 	{
-		// HJeS[̃ACe݂邩ǂ`FbN
-		if (pItem->GetItemCategory() == CItem::ITEM_CATEGORY::CookedFood ||
-			pItem->GetItemCategory() == CItem::ITEM_CATEGORY::UnCookedFood)
-		{
-			return true;
-		}
+		pObserver->OnStorageChanged(this, eType, nCount);
 	}
-
-	// H݂ȂꍇfalseԂ
-	return false;
-}
\ No newline at end of file
+}
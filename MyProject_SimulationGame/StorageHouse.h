@@ -7,6 +7,10 @@
 #pragma once
 #include "BuildObject.h"
 #include "Item.h"
+#include "ItemInventory.h"
+#include "StorageObserver.h"
+#include <list>
+#include <vector>
 
 // @brief ɃNX
 class CStorageHouse final:  public CBuildObject
@@ -28,38 +32,90 @@ public:
 
 	// @brief ACe̎[
 	// @param pItemF[ACe|C^
+	// @note ƂċL^AACe|C^͉
 	void StoreItem(CItem* pItem);
 
+	// @brief ACe̎[
+	// @param eTypeF[ACe^Cv
+	// @param nAmountF[
+	void StoreItem(const CItem::ITEM_TYPE eType, const int nAmount = 1);
+
+	// @brief ACeSĎ[
+	// @param sourceF[̏ACeiɂȂj
+	// @return [
+	int StoreAll(CItemInventory& source);
+
 	// @brief [ĂACe̎o
 	// @param eTypeFoACe^Cv
 	// @return oACe|C^A݂Ȃꍇnullptr
+	// @note oACȅL͌ĂяoɈڂ
 	CItem* TakeOutItem(CItem::ITEM_TYPE eType);
 
 	// @brief [ĂACe̎o
 	// @param eCategoryFoACeJeS[
 	// @return oACe|C^A݂Ȃꍇnullptr
+	// @note oACȅL͌ĂяoɈڂ
 	CItem* TakeOutItem(CItem::ITEM_CATEGORY eCategory);
 
-	// @brief [ĂACeXg̎擾
-	// @return [ĂACeXg̎Q
-	const std::list<CItem*>& GetStoredItems() const { return m_StoredItems; }
+	// @brief w肵ACe^Cv܂Ƃ߂Ďo
+	// @param eTypeFoACe^Cv
+	// @param nAmountFoő
+	// @param destFoACëړ
+	// @return ۂɎo
+	int TakeOutItems(const CItem::ITEM_TYPE eType, const int nAmount, CItemInventory& dest);
+
+	// @brief fރXg܂Ƃ߂Ďo
+	// @param materialsFofރXg
+	// @param destFofނ̈ړ
+	// @return true:SĎo false:sioȂj
+	bool TakeOutMaterials(const CItem::MaterialSpan& materials, CItemInventory& dest);
+
+	// @brief [ĂACe̎擾
+	// @return [ĂACe̎Q
+	const CItemInventory& GetStoredItems() const { return m_StoredItems; }
+
+	// @brief w肵ACe^Cv̎[擾
+	// @param eTypeFACe^Cv
+	// @return [
+	int GetItemCount(CItem::ITEM_TYPE eType) const { return m_StoredItems.GetCount(eType); }
 
 	// @brief w肵ACe^Cv݂邩ǂ擾
 	// @param eTypeFACe^Cv
 	// @return true:݂ false:݂Ȃ
-	bool HasItemType(CItem::ITEM_TYPE eType) const;
+	bool HasItemType(CItem::ITEM_TYPE eType) const { return m_StoredItems.GetCount(eType) > 0; }
 
 	// @brief w肵ACeJeS[݂邩ǂ擾
 	// @param eCategoryFACeJeS[
 	// @return true:݂ false:݂Ȃ
-	bool HasItemCategory(CItem::ITEM_CATEGORY eCategory) const;
+	bool HasItemCategory(CItem::ITEM_CATEGORY eCategory) const { return m_StoredItems.GetCategoryCount(eCategory) > 0; }
+
+	// @brief fރXg𖞂Ă邩ǂ擾
+	// @param materialsFKvfރXg
+	// @return true:SđĂ false:s
+	bool HasMaterials(const CItem::MaterialSpan& materials) const { return m_StoredItems.HasMaterials(materials); }
 
 	// @brief H݂邩ǂ擾
 	bool HasFood() const;
 
+	// @brief [̊Ď҂o^
+	// @param observerFo^Ď
+	void AddStorageObserver(IStorageObserver& observer) { m_StorageObservers.push_back(&observer); }
+
+	// @brief [̊Ď҂
+	// @param observerFĎ
+	void RemoveStorageObserver(IStorageObserver& observer) { m_StorageObservers.remove(&observer); }
+
 private:
-	// @brief [ĂACẽ}bv
-	std::list<CItem*> m_StoredItems;
+	// @brief [̕ωĎ҂֒ʒm
+	// @param eTypeFωACe^Cv
+	void NotifyItemChanged(const CItem::ITEM_TYPE eType);
+
+private:
+	// @brief [ĂACeiACe^CvƂ̌ƃJeS[Ƃ̍vj
+	CItemInventory m_StoredItems;
+
+	// @brief [̊Ď҃Xg
+	std::list<IStorageObserver*> m_StorageObservers;
 
 };
 
@@ -0,0 +1,30 @@
+/**************************************************//*
+	@file	| StorageObserver.h
+	@brief	| ɊĎC^[tF[Xht@C
+	@note	| ɂ̎[̕ω󂯎IuU[o[
+			| ωACe^Cvƕω̎[ʒm
+*//**************************************************/
+#pragma once
+#include "Item.h"
+
+// O錾
+class CStorageHouse;
+
+// @brief ɊĎC^[tF[X
+class IStorageObserver
+{
+public:
+	// @brief zfXgN^
+	virtual ~IStorageObserver() = default;
+
+	// @brief [̕ωʒm
+	// @param pStorageHouseFω
+	// @param eTypeFωACe^Cv
+	// @param nCountFω̎[
+	virtual void OnStorageChanged(CStorageHouse* pStorageHouse, const CItem::ITEM_TYPE eType, const int nCount) = 0;
+
+	// @brief ɂ̔jʒm
+	// @param pStorageHouseFj钙
+	// @note ʒm͒ɂւ̃|C^ێȂ
+	virtual void OnStorageDestroyed(CStorageHouse* pStorageHouse) = 0;
+};
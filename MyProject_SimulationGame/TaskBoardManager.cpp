@@ -0,0 +1,135 @@
+/**************************************************//*
+	@file	| TaskBoardManager.cpp
+	@brief	| Ɗ蓖ĊǗVXecppt@C
+	@note	| ̋󂢂̎EƖ\̎WΏۂԊuł܂Ƃ߂Ċ蓖Ă
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "TaskBoardManager.h"
+#include "Gatherer_Strategy.h"
+#include "Human.h"
+#include <algorithm>
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CTaskBoardManager::CTaskBoardManager()
+	: m_pWaitingWorkers()
+	, m_nFrameCount(0)
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CTaskBoardManager::~CTaskBoardManager()
+{
+	m_pWaitingWorkers.clear();
+}
+
+/*****************************************//*
+	@brief@	| XV
+	@note		| ԊuƂɑҋ@̍Ǝ҂ւ܂Ƃ߂čƂ蓖Ă
+*//*****************************************/
+void CTaskBoardManager::Update()
+{
+	// 蓖ĊԊuɒBĂȂΏ𔲂
+	if (++m_nFrameCount < TASK_ASSIGN_INTERVAL) return;
+	m_nFrameCount = 0;
+
+	// ܂Ƃ߂čƂ蓖Ă
+	AssignTasks();
+}
+
+/*****************************************//*
+	@brief@	| Ɗ蓖Ă˗
+	@param		| pWorkerFƂ҂Ă̎E
+*//*****************************************/
+void CTaskBoardManager::RequestTask(CGatherer_Strategy* pWorker)
+{
+	if (pWorker == nullptr) return;
+
+	// Ɉ˗ς݂̏ꍇ͒ǉȂit[Ă΂̂ŃXg͒TȂj
+	if (pWorker->IsTaskRequested()) return;
+
+	pWorker->SetTaskRequested(true);
+	m_pWaitingWorkers.push_back(pWorker);
+}
+
+/*****************************************//*
+	@brief@	| Ɗ蓖Ă̈˗
+	@param		| pWorkerF̎E
+*//*****************************************/
+void CTaskBoardManager::CancelRequest(CGatherer_Strategy* pWorker)
+{
+	// ˗ĂȂꍇ̓XgTȂ
+	if (pWorker == nullptr || !pWorker->IsTaskRequested()) return;
+
+	pWorker->SetTaskRequested(false);
+	m_pWaitingWorkers.erase(
+		std::remove(m_pWaitingWorkers.begin(), m_pWaitingWorkers.end(), pWorker),
+		m_pWaitingWorkers.end());
+}
+
+/*****************************************//*
+	@brief@	| ҋ@̍Ǝ҂ƎWΏۂ̋߂g×~Ɋ蓖Ă
+	@note		| Ǝ҂Ƃɋ߂𐔌W߁ASgɕׂ
+				| ƎҁEWΏۂ̂ǂ蓖Ă̑gm肵Ă
+*//*****************************************/
+void CTaskBoardManager::AssignTasks()
+{
+	if (m_pWaitingWorkers.empty()) return;
+
+	// Ǝ҂ƎWΏۂ̑g
+	struct TaskPair
+	{
+		float fDistSq;				// 2
+		size_t nWorkerIndex;		// Ǝ҂̃CfbNX
+		CCollectTarget* pTarget;	// WΏ
+	};
+
+	std::vector<TaskPair> pairs;
+	pairs.reserve(m_pWaitingWorkers.size() * CANDIDATES_PER_WORKER);
+
+	// Ǝ҂Ƃɋ߂W߂
+	for (size_t i = 0; i < m_pWaitingWorkers.size(); ++i)
+	{
+		CGatherer_Strategy* pWorker = m_pWaitingWorkers[i];
+		if (pWorker->GetOwner() == nullptr) continue;
+
+		DirectX::XMFLOAT3 workerPos = pWorker->GetOwner()->GetPos();
+		for (CCollectTarget* pTarget : pWorker->SearchTargets(CANDIDATES_PER_WORKER))
+		{
+			DirectX::XMFLOAT3 targetPos = pTarget->GetPos();
+			const float dx = workerPos.x - targetPos.x;
+			const float dy = workerPos.y - targetPos.y;
+			const float dz = workerPos.z - targetPos.z;
+			pairs.push_back({ dx * dx + dy * dy + dz * dz, i, pTarget });
+		}
+	}
+
+	// ̋߂g珇Ɋm肷
+	std::sort(pairs.begin(), pairs.end(),
+		[](const TaskPair& a, const TaskPair& b) { return a.fDistSq < b.fDistSq; });
+
+	std::vector<bool> assigned(m_pWaitingWorkers.size(), false);
+	for (const TaskPair& pair : pairs)
+	{
+		if (assigned[pair.nWorkerIndex]) continue;
+
+		// ̍Ǝ҂ɐɗ\񂳂ꂽWΏۂ͊蓖ĂɎs
+		if (m_pWaitingWorkers[pair.nWorkerIndex]->AssignTarget(pair.pTarget))
+		{
+			assigned[pair.nWorkerIndex] = true;
+		}
+	}
+
+	// 蓖Ăm肵Ǝ҂ҋ@XgO
+	// 蓖ĂȂƎ҂͎̊蓖Ă܂őҋ@
+	size_t nWrite = 0;
+	for (size_t i = 0; i < m_pWaitingWorkers.size(); ++i)
+	{
+		if (!assigned[i]) m_pWaitingWorkers[nWrite++] = m_pWaitingWorkers[i];
+		else m_pWaitingWorkers[i]->SetTaskRequested(false);
+	}
+	m_pWaitingWorkers.resize(nWrite);
+}
@@ -0,0 +1,59 @@
+/**************************************************//*
+	@file	| TaskBoardManager.h
+	@brief	| Ɗ蓖ĊǗVXeht@C
+	@note	| ̋󂢂̎EƖ\̎WΏۂԊuł܂Ƃ߂Ċ蓖Ă
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include <vector>
+
+// O錾
+class CGatherer_Strategy;
+
+// @brief Ɗ蓖ĊǗVXeNX
+class CTaskBoardManager : public ISingleton<CTaskBoardManager>
+{
+private:
+	// @brief 蓖ďsԊuit[j
+	static constexpr int TASK_ASSIGN_INTERVAL = 10;
+
+	// @brief Ǝ҈lɌWΏۂ̌␔
+	static constexpr size_t CANDIDATES_PER_WORKER = 4;
+
+private:
+	// @brief RXgN^
+	CTaskBoardManager();
+
+	friend class ISingleton<CTaskBoardManager>;
+
+public:
+	// @brief fXgN^
+	~CTaskBoardManager();
+
+	// @brief XV
+	// @note ԊuƂɑҋ@̍Ǝ҂ւ܂Ƃ߂čƂ蓖Ă
+	void Update();
+
+	// @brief Ɗ蓖Ă˗
+	// @param pWorkerFƂ҂Ă̎E
+	void RequestTask(CGatherer_Strategy* pWorker);
+
+	// @brief Ɗ蓖Ă̈˗
+	// @param pWorkerF̎E
+	void CancelRequest(CGatherer_Strategy* pWorker);
+
+	// @brief Ɗ蓖đ҂̐l擾
+	size_t GetWaitingWorkerCount() const { return m_pWaitingWorkers.size(); }
+
+private:
+	// @brief ҋ@̍Ǝ҂ƎWΏۂ̋߂g×~Ɋ蓖Ă
+	void AssignTasks();
+
+private:
+	// @brief Ɗ蓖đ҂̍̎EXg
+	std::vector<CGatherer_Strategy*> m_pWaitingWorkers;
+
+	// @brief O̊蓖Ă̌o߃t[
+	int m_nFrameCount;
+};
@@ -0,0 +1,251 @@
+/**************************************************//*
+	@file	| VitalsManager.cpp
+	@brief	| lǗVXecppt@C
+	@note	| GeBeB̗̑́E󕠓xEX^~iAzŕێA
+			| Rƕ␳Alx̑ł܂Ƃ߂čs
+			| lzGeBeBɂCxgʒm
+			| VOgp^[ō쐬
+*//**************************************************/
+#include "VitalsManager.h"
+#include "Entity.h"
+#include <algorithm>
+
+/*****************************************//*
+	@brief@	| RXgN^
+*//*****************************************/
+CVitalsManager::CVitalsManager()
+	: m_fHealth()
+	, m_fMaxHealth()
+	, m_fHunger()
+	, m_fHungerDecrease()
+	, m_fStamina()
+	, m_fMaxStamina()
+	, m_nStarvable()
+	, m_nFlags()
+	, m_nNewFlags()
+	, m_pOwners()
+	, m_nHandles()
+	, m_nHandleToIndex()
+	, m_nFreeHandles()
+	, m_PendingEvents()
+{
+}
+
+/*****************************************//*
+	@brief@	| fXgN^
+*//*****************************************/
+CVitalsManager::~CVitalsManager()
+{
+}
+
+/*****************************************//*
+	@brief@	| XV
+	@note		| Ɣ͕̖Pȃ[vɂĎxNg
+				| Cxg͑O񂩂VɗtOɂĂʒm
+*//*****************************************/
+void CVitalsManager::Update()
+{
+	const size_t nCount = m_pOwners.size();
+	if (nCount == 0) return;
+
+	float* pHunger = m_fHunger.data();
+	const float* pHungerDecrease = m_fHungerDecrease.data();
+	const float* pHealth = m_fHealth.data();
+	const float* pStamina = m_fStamina.data();
+	const uint8_t* pStarvable = m_nStarvable.data();
+	uint8_t* pNewFlags = m_nNewFlags.data();
+
+	// 󕠓x̎Rƕ␳
+	for (size_t i = 0; i < nCount; ++i)
+	{
+		pHunger[i] = std::max(pHunger[i] - pHungerDecrease[i], 0.0f);
+	}
+
+	// l
+	for (size_t i = 0; i < nCount; ++i)
+	{
+		uint8_t nWarning = static_cast<uint8_t>(pHunger[i] <= Warning_Hunger);
+		uint8_t nZeroStamina = static_cast<uint8_t>(pStamina[i] <= 0.0f);
+		uint8_t nStarved = static_cast<uint8_t>(pHunger[i] <= 0.0f) & pStarvable[i];
+		uint8_t nDied = static_cast<uint8_t>(pHealth[i] <= 0.0f) | nStarved;
+		pNewFlags[i] = static_cast<uint8_t>(nWarning * FLAG_WARNING_HUNGER | nZeroStamina * FLAG_ZERO_STAMINA | nDied * FLAG_DIED);
+	}
+
+	// VɗtOCxgƂĎo
+	m_PendingEvents.clear();
+	for (size_t i = 0; i < nCount; ++i)
+	{
+		uint8_t nRaised = pNewFlags[i] & ~m_nFlags[i];
+		m_nFlags[i] = pNewFlags[i];
+		if (nRaised == 0) continue;
+
+		if (nRaised & FLAG_WARNING_HUNGER) m_PendingEvents.push_back({ m_pOwners[i], VitalsEvent::WarningHunger });
+		if (nRaised & FLAG_ZERO_STAMINA) m_PendingEvents.push_back({ m_pOwners[i], VitalsEvent::ZeroStamina });
+		if (nRaised & FLAG_DIED) m_PendingEvents.push_back({ m_pOwners[i], VitalsEvent::Died });
+	}
+
+	// Cxgʒmiʒmɓo^ꂽGeBeB͏Oς݁j
+	for (const PendingEvent& event : m_PendingEvents)
+	{
+		if (event.pEntity == nullptr) continue;
+		event.pEntity->OnVitalsEvent(event.eEvent);
+	}
+}
+
+/*****************************************//*
+	@brief@	| GeBeB̓o^
+	@param		| pEntityFGeBeB
+	@return		| l̃nh
+*//*****************************************/
+int CVitalsManager::Register(CEntity* pEntity)
+{
+	// nh̊蓖āi󂫂΍ėpj
+	int nHandle;
+	if (!m_nFreeHandles.empty())
+	{
+		nHandle = m_nFreeHandles.back();
+		m_nFreeHandles.pop_back();
+	}
+	else
+	{
+		nHandle = static_cast<int>(m_nHandleToIndex.size());
+		m_nHandleToIndex.push_back(INVALID_HANDLE);
+	}
+
+	// ɏlŒǉ
+	m_nHandleToIndex[nHandle] = static_cast<int>(m_pOwners.size());
+	m_fHealth.push_back(100.0f);
+	m_fMaxHealth.push_back(100.0f);
+	m_fHunger.push_back(Max_Hunger);
+	m_fHungerDecrease.push_back(0.0f);
+	m_fStamina.push_back(Job_Max_Stamina);
+	m_fMaxStamina.push_back(Job_Max_Stamina);
+	m_nStarvable.push_back(0);
+	m_nFlags.push_back(0);
+	m_nNewFlags.push_back(0);
+	m_pOwners.push_back(pEntity);
+	m_nHandles.push_back(nHandle);
+
+	return nHandle;
+}
+
+/*****************************************//*
+	@brief@	| GeBeB̓o^
+	@param		| nHandleFl̃nh
+*//*****************************************/
+void CVitalsManager::Unregister(int nHandle)
+{
+	if (nHandle < 0 || nHandle >= static_cast<int>(m_nHandleToIndex.size())) return;
+
+	int nIndex = m_nHandleToIndex[nHandle];
+	if (nIndex == INVALID_HANDLE) return;
+
+	// ʒm҂̃CxgO
+	CEntity* pEntity = m_pOwners[nIndex];
+	for (PendingEvent& event : m_PendingEvents)
+	{
+		if (event.pEntity == pEntity) event.pEntity = nullptr;
+	}
+
+	RemoveAt(nIndex);
+}
+
+/*****************************************//*
+	@brief@	| ̗͂̉Z
+	@param		| nHandleFl̃nh
+	@param		| fAmountFZ
+*//*****************************************/
+void CVitalsManager::AddHealth(int nHandle, float fAmount)
+{
+	int nIndex = m_nHandleToIndex[nHandle];
+	m_fHealth[nIndex] = std::clamp(m_fHealth[nIndex] + fAmount, 0.0f, m_fMaxHealth[nIndex]);
+}
+
+/*****************************************//*
+	@brief@	| ő̗͂̐ݒ
+	@param		| nHandleFl̃nh
+	@param		| fMaxHealthFő̗
+*//*****************************************/
+void CVitalsManager::SetMaxHealth(int nHandle, float fMaxHealth)
+{
+	int nIndex = m_nHandleToIndex[nHandle];
+	m_fMaxHealth[nIndex] = fMaxHealth;
+	m_fHealth[nIndex] = fMaxHealth;
+}
+
+/*****************************************//*
+	@brief@	| 󕠓x̉Z
+	@param		| nHandleFl̃nh
+	@param		| fAmountFZ
+*//*****************************************/
+void CVitalsManager::AddHunger(int nHandle, float fAmount)
+{
+	int nIndex = m_nHandleToIndex[nHandle];
+	m_fHunger[nIndex] = std::clamp(m_fHunger[nIndex] + fAmount, 0.0f, Max_Hunger);
+}
+
+/*****************************************//*
+	@brief@	| X^~ỉZ
+	@param		| nHandleFl̃nh
+	@param		| fAmountFZ
+*//*****************************************/
+void CVitalsManager::AddStamina(int nHandle, float fAmount)
+{
+	int nIndex = m_nHandleToIndex[nHandle];
+	m_fStamina[nIndex] = std::clamp(m_fStamina[nIndex] + fAmount, 0.0f, m_fMaxStamina[nIndex]);
+}
+
+/*****************************************//*
+	@brief@	| őX^~i̐ݒ
+	@param		| nHandleFl̃nh
+	@param		| fMaxStaminaFőX^~i
+*//*****************************************/
+void CVitalsManager::SetMaxStamina(int nHandle, float fMaxStamina)
+{
+	int nIndex = m_nHandleToIndex[nHandle];
+	m_fMaxStamina[nIndex] = fMaxStamina;
+	m_fStamina[nIndex] = fMaxStamina;
+}
+
+/*****************************************//*
+	@brief@	| w肵ʒũGeBeB폜
+	@param		| nIndexF폜ʒu
+	@note		| ̗vf폜ʒuֈړċl߂
+*//*****************************************/
+void CVitalsManager::RemoveAt(size_t nIndex)
+{
+	size_t nLast = m_pOwners.size() - 1;
+
+	// nh
+	m_nHandleToIndex[m_nHandles[nIndex]] = INVALID_HANDLE;
+	m_nFreeHandles.push_back(m_nHandles[nIndex]);
+
+	// ̗vfړ
+	if (nIndex != nLast)
+	{
+		m_fHealth[nIndex] = m_fHealth[nLast];
+		m_fMaxHealth[nIndex] = m_fMaxHealth[nLast];
+		m_fHunger[nIndex] = m_fHunger[nLast];
+		m_fHungerDecrease[nIndex] = m_fHungerDecrease[nLast];
+		m_fStamina[nIndex] = m_fStamina[nLast];
+		m_fMaxStamina[nIndex] = m_fMaxStamina[nLast];
+		m_nStarvable[nIndex] = m_nStarvable[nLast];
+		m_nFlags[nIndex] = m_nFlags[nLast];
+		m_nNewFlags[nIndex] = m_nNewFlags[nLast];
+		m_pOwners[nIndex] = m_pOwners[nLast];
+		m_nHandles[nIndex] = m_nHandles[nLast];
+		m_nHandleToIndex[m_nHandles[nIndex]] = static_cast<int>(nIndex);
+	}
+
+	m_fHealth.pop_back();
+	m_fMaxHealth.pop_back();
+	m_fHunger.pop_back();
+	m_fHungerDecrease.pop_back();
+	m_fStamina.pop_back();
+	m_fMaxStamina.pop_back();
+	m_nStarvable.pop_back();
+	m_nFlags.pop_back();
+	m_nNewFlags.pop_back();
+	m_pOwners.pop_back();
+	m_nHandles.pop_back();
+}
@@ -0,0 +1,144 @@
+/**************************************************//*
+	@file	| VitalsManager.h
+	@brief	| lǗVXeht@C
+	@note	| GeBeB̗̑́E󕠓xEX^~iAzŕێA
+			| Rƕ␳Alx̑ł܂Ƃ߂čs
+			| lzGeBeBɂCxgʒm
+			| VOgp^[ō쐬
+*//**************************************************/
+#pragma once
+#include "Singleton.h"
+#include <vector>
+#include <cstdint>
+
+// O錾
+class CEntity;
+
+// @brief lǗVXeNX
+class CVitalsManager : public ISingleton<CVitalsManager>
+{
+public:
+	// @brief lCxg̎
+	enum class VitalsEvent
+	{
+		WarningHunger,	// 󕠓xxlȉɂȂ
+		ZeroStamina,	// X^~i0ɂȂ
+		Died,			// ̗͂0ɂȂA܂͉쎀
+	};
+
+	// @brief ȃnh
+	static constexpr int INVALID_HANDLE = -1;
+
+private:
+	// @brief l̏ԃtO
+	static constexpr uint8_t FLAG_WARNING_HUNGER = 1 << 0;
+	static constexpr uint8_t FLAG_ZERO_STAMINA = 1 << 1;
+	static constexpr uint8_t FLAG_DIED = 1 << 2;
+
+private:
+	// @brief RXgN^
+	CVitalsManager();
+
+	friend class ISingleton<CVitalsManager>;
+
+public:
+	// @brief fXgN^
+	~CVitalsManager();
+
+	// @brief XV
+	// @note SGeBeB̋󕠓xAlzGeBeBɃCxgʒm
+	void Update();
+
+	// @brief GeBeB̓o^
+	// @param pEntityFGeBeB
+	// @return l̃nh
+	int Register(CEntity* pEntity);
+
+	// @brief GeBeB̓o^
+	// @param nHandleFl̃nh
+	void Unregister(int nHandle);
+
+	// @brief ̗͂̎擾
+	float GetHealth(int nHandle) const { return m_fHealth[m_nHandleToIndex[nHandle]]; }
+	// @brief ő̗͂̎擾
+	float GetMaxHealth(int nHandle) const { return m_fMaxHealth[m_nHandleToIndex[nHandle]]; }
+	// @brief ̗͂̉Zi0`ő̗͂ɕ␳j
+	// @param fAmountFZʁi̒lŌj
+	void AddHealth(int nHandle, float fAmount);
+	// @brief ő̗͂̐ݒi̗͂ő܂ŉ񕜁j
+	// @param fMaxHealthFő̗
+	void SetMaxHealth(int nHandle, float fMaxHealth);
+
+	// @brief 󕠓x̎擾
+	float GetHunger(int nHandle) const { return m_fHunger[m_nHandleToIndex[nHandle]]; }
+	// @brief 󕠓x̉Zi0`ő󕠒lɕ␳j
+	// @param fAmountFZʁi̒lŌj
+	void AddHunger(int nHandle, float fAmount);
+	// @brief t[̋󕠓x̎Rʂ̐ݒ
+	// @param fDecreaseF
+	void SetHungerDecrease(int nHandle, float fDecrease) { m_fHungerDecrease[m_nHandleToIndex[nHandle]] = fDecrease; }
+	// @brief 󕠓x0ɂȂɉ쎀邩ǂ̐ݒ
+	// @param bStarvableFtrue:쎀 false:쎀Ȃ
+	void SetStarvable(int nHandle, bool bStarvable) { m_nStarvable[m_nHandleToIndex[nHandle]] = bStarvable ? 1 : 0; }
+
+	// @brief X^~i̎擾
+	float GetStamina(int nHandle) const { return m_fStamina[m_nHandleToIndex[nHandle]]; }
+	// @brief őX^~i̎擾
+	float GetMaxStamina(int nHandle) const { return m_fMaxStamina[m_nHandleToIndex[nHandle]]; }
+	// @brief X^~ỉZi0`őX^~iɕ␳j
+	// @param fAmountFZʁi̒lŌj
+	void AddStamina(int nHandle, float fAmount);
+	// @brief őX^~i̐ݒiX^~iő܂ŉ񕜁j
+	// @param fMaxStaminaFőX^~i
+	void SetMaxStamina(int nHandle, float fMaxStamina);
+
+	// @brief o^̃GeBeB擾
+	size_t GetEntityCount() const { return m_pOwners.size(); }
+
+private:
+	// @brief w肵ʒũGeBeB폜iƓւċl߂j
+	// @param nIndexF폜ʒu
+	void RemoveAt(size_t nIndex);
+
+private:
+	// @brief Cxgʒm\
+	struct PendingEvent
+	{
+		CEntity* pEntity;		// ʒm
+		VitalsEvent eEvent;		// Cxg̎
+	};
+
+	// ȉ͓ʒu̗vf̃GeBeB\i\̂̔zł͂Ȃz̍\́j
+
+	// @brief ̗
+	std::vector<float> m_fHealth;
+	// @brief ő̗
+	std::vector<float> m_fMaxHealth;
+	// @brief 󕠓x
+	std::vector<float> m_fHunger;
+	// @brief t[̋󕠓x̎R
+	std::vector<float> m_fHungerDecrease;
+	// @brief X^~i
+	std::vector<float> m_fStamina;
+	// @brief őX^~i
+	std::vector<float> m_fMaxStamina;
+	// @brief 쎀邩ǂi0 or 1j
+	std::vector<uint8_t> m_nStarvable;
+	// @brief O񔻒莞̂ltO
+	std::vector<uint8_t> m_nFlags;
+	// @brief 񔻒肵ltO
+	std::vector<uint8_t> m_nNewFlags;
+	// @brief GeBeB
+	std::vector<CEntity*> m_pOwners;
+	// @brief nh
+	std::vector<int> m_nHandles;
+
+	// @brief nhz̈ʒuւ̕ϊ\igpINVALID_HANDLEj
+	std::vector<int> m_nHandleToIndex;
+
+	// @brief ėpłnh
+	std::vector<int> m_nFreeHandles;
+
+	// @brief Cxgʒm̈ꎞobt@it[̊mۂ邽ߕێj
+	std::vector<PendingEvent> m_PendingEvents;
+};
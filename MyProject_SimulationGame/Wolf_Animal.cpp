@@ -7,9 +7,11 @@
 #include "Wolf_Animal.h"
 #include "FlockAttackAI.h"
 #include "Oparation.h"
+#include "SteeringMath.h"
 #include "Main.h"
 #include "HerbivorousAnimal.h"
 #include "GameTimeManager.h"
+#include "Flock.h"
 #include <algorithm>
 
 /****************************************//*
@@ -38,6 +40,9 @@ CWolf_Animal::CWolf_Animal()
 	// WcUAI
 	m_pActionAI = new(std::nothrow) CFlockAttackAI(params);
 
+	// 씼a̘TQƂĈ
+	RegisterToSpatialGrid(AnimalKind::Wolf, params.fViewRadius);
+
 	// ÚEUԊuݒ
 	m_fAttack =15.0f;
 	m_fAttackInterval =0.8f;
@@ -69,6 +74,9 @@ void CWolf_Animal::Init()
 *//****************************************/
 void CWolf_Animal::Update()
 {
+	// QɏW񂳂ĂԂ͌Qꂪ܂Ƃ߂Ĉړ
+	if (IsCollapsed()) return;
+
 	// eNXXV
 	CCarnivorousAnimal::Update();
 
@@ -93,19 +101,18 @@ void CWolf_Animal::Update()
 		{
 			pAI->ClearTarget();
 		}
+		m_nPreyHandle = CAnimalSpatialGrid::INVALID_HANDLE;
+		if (m_pFlock) m_pFlock->ClearTarget();
 		break;
 	}
 
-	// ʒuEx擾
-	DirectX::XMFLOAT3 pos = m_tParam.m_f3Pos;
-	DirectX::XMFLOAT3 vel = m_f3Velocity;
+	// x擾i߂܂XMVECTOR̂܂܌vZj
+	DirectX::XMVECTOR vel = SteeringMath::Load(m_f3Velocity);
 
-	// sAIXV
-	DirectX::XMFLOAT3 steer = m_pActionAI->UpdateAI(pos, vel, m_SameAnimalNeighbors);
-	// xXV
-	vel += steer * fDeltaTime;
+	// xXVisAĨXeAOCAnimalSimulationŌvZς݁j
+	vel = DirectX::XMVectorAdd(vel, DirectX::XMVectorScale(SteeringMath::Load(m_f3Steering), fDeltaTime));
 	// iCRj
-	vel = vel * 0.98f;
+	vel = DirectX::XMVectorScale(vel, 0.98f);
 
 	// X^~iɂ鑬x
 	const float staminaMax = (GetMaxStamina() >0.0f) ? GetMaxStamina() :1.0f;
@@ -146,10 +153,8 @@ void CWolf_Animal::Update()
 		// WIꍇ
 		if (hasTarget)
 		{
-			// WÏʒu擾
-			DirectX::XMFLOAT3 targetPos = pFlockAI->GetTargetPosition();
-			// WI̓擾
-			pTarget = GetScene()->GetGameObject<CHerbivorousAnimal>(targetPos);
+			// ǐՒ̊l擾
+			pTarget = GetPrey();
 
 			// WI݂ꍇ
 			if (pTarget)
@@ -178,12 +183,12 @@ void CWolf_Animal::Update()
 	float maxSpeed = (minMaxSpeed + (baseMaxSpeed - minMaxSpeed) * staminaRate) * targetExhaustBoost * distanceBoost;
 
 	// x
-	float speed = StructMath::Length(vel);
+	float speed = SteeringMath::Length(vel);
 	// ő呬x𒴂Ă琧
 	if (speed > maxSpeed && speed >0.0001f)
 	{
 		// Kčő呬xɒ
-		vel = vel * (maxSpeed / speed);
+		vel = DirectX::XMVectorScale(vel, maxSpeed / speed);
 		speed = maxSpeed;
 	}
 
@@ -230,7 +235,7 @@ void CWolf_Animal::Update()
 	}
 
 	// xۑ
-	m_f3Velocity = { vel.x, vel.y, vel.z };
+	m_f3Velocity = SteeringMath::Store(vel);
 	// XViXZʁj
 	m_tParam.m_f3Rotate.y = atan2f(m_f3Velocity.x, m_f3Velocity.z);
 	// ʒuXV
@@ -247,65 +252,85 @@ void CWolf_Animal::SetTarget()
 	// UAIΏI
 	if (!pFlockAI) return;
 
-	// Q̒N^[QbgĂ狤L
-	for (const BoidsNeighbor& Animal : m_SameAnimalNeighbors)
+	// ǐՒ̊lĂ΂̂܂ܒǂ
+	CHerbivorousAnimal* pPrey = GetPrey();
+
+	// Q̊lL
+	if (!pPrey && m_pFlock && m_pFlock->HasTarget())
+	{
+		m_nPreyHandle = m_pFlock->GetTargetHandle();
+		pPrey = GetPrey();
+	}
+
+	// ߂̕ʂ̌Q̘TlĂ狤L
+	if (!pPrey)
+	{
+		for (const BoidsNeighbor& Animal : m_SameAnimalNeighbors)
+		{
+			// ^[Qbgݒ肳ĂȂ΃XLbv
+			if (!Animal.bSetTarget) continue;
+			// l̃nhL
+			m_nPreyHandle = Animal.nTargetHandle;
+			pPrey = GetPrey();
+			if (pPrey) break;
+		}
+	}
+
+	// ͈͓ōł߂HT
+	if (!pPrey)
 	{
-		// ^[Qbgݒ肳ĂȂ΃XLbv
-		if (!Animal.bSetTarget) continue;
-		// ^[QbgʒuL
-		pFlockAI->SetTargetPosition(Animal.pTargetPos);
+		m_nPreyHandle = CAnimalSpatialGrid::GetInstance()->FindNearest(AnimalKind::Deer, m_tParam.m_f3Pos, m_fHuntRange);
+		pPrey = GetPrey();
+	}
+
+	// lȂΕWI
+	if (!pPrey)
+	{
+		pFlockAI->ClearTarget();
 		return;
 	}
 
-	// g̃^[Qbgݒ
-	CHerbivorousAnimal* pTargetAnimal = GetScene()->GetGameObject<CHerbivorousAnimal>(m_tParam.m_f3Pos);
-	// ^[Qbg݂ȂΏI
-	if (!pTargetAnimal) return;
+	// Q̊lƂċL
+	if (m_pFlock) m_pFlock->SetTarget(m_nPreyHandle);
 
 	// ^[Qbgʒuݒ
-	pFlockAI->SetTargetPosition(pTargetAnimal->GetPos());
+	pFlockAI->SetTargetPosition(pPrey->GetPos());
 }
 
 /****************************************//*
-	@brief	| Qo^
+	@brief	| ǐՒ̊l̎擾
+	@return	| ĂlAȂnullptr
 *//****************************************/
-void CWolf_Animal::RegisterToFlock(std::vector<CWolf_Animal*> In_Wolfs)
+CHerbivorousAnimal* CWolf_Animal::GetPrey()
 {
-	// 퓮XgNA
-	m_SameAnimalNeighbors.clear();
+	if (m_nPreyHandle == CAnimalSpatialGrid::INVALID_HANDLE) return nullptr;
 
-	// ߂̓퓮o^
-	for (CWolf_Animal* wolf : In_Wolfs)
+	// ljς݁ASA܂͌QɏW񂳂Ă΃nh
+	auto* pPrey = dynamic_cast<CHerbivorousAnimal*>(CAnimalSpatialGrid::GetInstance()->FindAnimal(m_nPreyHandle));
+	if (!pPrey || pPrey->IsDead() || pPrey->IsCollapsed())
 	{
-		// g̓XLbv
-		if (wolf == this) continue;
-
-		// 苗ȏ㗣ĂXLbv
-		float dist = StructMath::Distance(GetPos(), wolf->GetPos());
-		if (dist >20.0f) continue;
-
-		// Q̓̍sAI擾
-		auto* pFlockAI = dynamic_cast<CFlockAttackAI*>(wolf->m_pActionAI);
-
-		// ߗ׏o^
-		BoidsNeighbor neighbor;
-		// ʒu
-		neighbor.v3Position = { wolf->m_tParam.m_f3Pos.x, wolf->m_tParam.m_f3Pos.y, wolf->m_tParam.m_f3Pos.z };
-		// x
-		neighbor.v3Velocity = { wolf->m_f3Velocity.x, wolf->m_f3Velocity.y, wolf->m_f3Velocity.z };
-		// WIݒL
-		neighbor.bSetTarget = (pFlockAI != nullptr) ? pFlockAI->HasTarget() : false;
-		// WIʒu
-		neighbor.pTargetPos = (pFlockAI != nullptr) ? pFlockAI->GetTargetPosition() : DirectX::XMFLOAT3(0,0,0);
-
-		// Xgɒǉ
-		m_SameAnimalNeighbors.push_back(neighbor);
+		m_nPreyHandle = CAnimalSpatialGrid::INVALID_HANDLE;
+		return nullptr;
 	}
 
-	// g̃z[|WVݒ
+	return pPrey;
+}
+
+/****************************************//*
+	@brief	| Q̋ߗ׏̍쐬
+	@return	| ʒuExƌQŋLWI
+*//****************************************/
+BoidsNeighbor CWolf_Animal::MakeBoidsNeighbor() const
+{
+	BoidsNeighbor neighbor = CCarnivorousAnimal::MakeBoidsNeighbor();
+
+	// WIQŋL
 	if (auto* pFlockAI = dynamic_cast<CFlockAttackAI*>(m_pActionAI))
 	{
-		// z[|WVݒ
-		pFlockAI->SetHomePosition(GetPos());
+		neighbor.bSetTarget = pFlockAI->HasTarget();
+		neighbor.pTargetPos = pFlockAI->GetTargetPosition();
+		neighbor.nTargetHandle = m_nPreyHandle;
 	}
+
+	return neighbor;
 }
\ No newline at end of file
@@ -7,6 +7,9 @@
 #pragma once
 #include "CarnivorousAnimal.h"
 
+// O錾
+class CHerbivorousAnimal;
+
 
 // TNX
 class CWolf_Animal final: public CCarnivorousAnimal
@@ -27,12 +30,23 @@ public:
 	// @brief WI̐ݒ
 	void SetTarget();
 
-	// @brief Q̓o^
-	// @param In_WolfsFIIJ~Xg
-	void RegisterToFlock(std::vector<CWolf_Animal*> In_Wolfs);
+	// @brief Q̋ߗ׏̍쐬
+	// @return ʒuExƌQŋLWI
+	BoidsNeighbor MakeBoidsNeighbor() const override;
+
+private:
+	// @brief ǐՒ̊l̎擾
+	// @return ĂlAȂnullptrinhj
+	CHerbivorousAnimal* GetPrey();
 
 private:
 	// @brief UN[_Eibj
 	float m_fAttackCooldown =0.0f;
+
+	// @brief ǐՒ̊l̃nh
+	int m_nPreyHandle = CAnimalSpatialGrid::INVALID_HANDLE;
+
+	// @brief lT͈
+	float m_fHuntRange = 40.0f;
 };
 
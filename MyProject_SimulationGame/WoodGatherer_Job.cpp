@@ -19,14 +19,16 @@ CWoodGatherer_Job::CWoodGatherer_Job()
 }
 
 /******************************************//*
-	@brief@	| WIT
-	@return		| ̎ΏۃIuWFNg̃|C^
+	@brief@	| WǏT
+	@param		| nMaxCountF擾ő吔
+	@return		| \ŋ߂ɕ񂾍̎ΏۃIuWFNg̃|C^Xg
 	@note		| ؃IuWFNgT
 *//******************************************/
-CCollectTarget* CWoodGatherer_Job::SearchTarget(std::vector<ObjectID> vNotTargetIDs)
+std::vector<CCollectTarget*> CWoodGatherer_Job::SearchTargets(const size_t nMaxCount)
 {
 	// ؃IuWFNgT
-	return GetScene()->GetGameObject<CWood>(m_pOwner->GetPos(), vNotTargetIDs);
+	std::vector<CWood*> targets = CCollectTarget::FindUnclaimedCandidates<CWood>(m_pOwner->GetPos(), nMaxCount);
+	return std::vector<CCollectTarget*>(targets.begin(), targets.end());
 }
 
 /******************************************//*
@@ -2,35 +2,28 @@
 	@file	| WoodGenerator.cpp
 	@brief	| ؍ރWFl[^[NXht@C
 	@note	| ؍ނ𐶐WFl[^[
-			| IGeneratorp
+			| CRegrowthGeneratorp
 *//**************************************************/
 #include "WoodGenerator.h"
 #include "Wood.h"
 #include "Main.h"
-#include "ImguiSystem.h"
 
 #undef min
 
 /*****************************************
-	@brief@	| 
+	@brief@	| RXgN^
 *//*****************************************/
-void CWoodGenerator::Generate()
+CWoodGenerator::CWoodGenerator()
+	: CRegrowthGenerator(CFieldCell::CellType::TREE, REGROW_TIME, u8"")
 {
-	// ؂zu\ȖgpZ擾
-	auto cells = CFieldManager::GetInstance()->GetFieldGrid()->GetFieldCells(CFieldCell::CellType::TREE, false);
-
-	// zu\ȃZȂΏI
-	if (cells.empty()) return;
-
-	// ؂̍ő吶
-	int createNum = 0;
-	for(auto cell : cells)
-	{
-		// ؃IuWFNg𐶐AIoZɔzu
-		GetScene()->AddGameObject<CWood>(Tag::GameObject, u8"")->SetCreatePos(cell);
-		createNum++;
-	}
+}
 
-	// fobOO̒ǉ
-	CImguiSystem::GetInstance()->AddDebugLog(std::string(u8"؂") + std::to_string(createNum) + std::string(u8"܂"), false);
+/*****************************************
+	@brief@	| IuWFNg̐
+	@param@	| pCellF̃Z
+*//*****************************************/
+void CWoodGenerator::SpawnResource(CFieldCell* pCell)
+{
+	// ؃IuWFNg𐶐AZɔzu
+	GetScene()->AddGameObject<CWood>(Tag::GameObject, u8"")->SetCreatePos(pCell);
 }
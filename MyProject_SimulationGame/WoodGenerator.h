@@ -2,15 +2,23 @@
 	@file	| WoodGenerator.h
 	@brief	| ؍ރWFl[^[NXht@C
 	@note	| ؍ނ𐶐WFl[^[
-			| IGeneratorp
+			| CRegrowthGeneratorp
 *//**************************************************/
 #pragma once
 #include "Generator.h"
 
 // @brief ؍ރWFl[^[NX
-class CWoodGenerator final : public IGenerator
+class CWoodGenerator final : public CRegrowthGenerator
 {
+public:
+	// @brief ͊ĂĐ܂ł̎ԁibj
+	static constexpr float REGROW_TIME = 60.0f;
+
+	// @brief RXgN^
+	CWoodGenerator();
+
 private:
-	// @brief 
-	void Generate() override;
+	// @brief IuWFNg̐
+	// @param pCellF̃Z
+	void SpawnResource(CFieldCell* pCell) override;
 };